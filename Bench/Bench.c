@@ -0,0 +1,478 @@
+/**
+ * @file Bench.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b End-to-end benchmark of `Api.h` functions, run against a local stub server
+ *    (or an in-process handler), so that request building, transport and response
+ *    parsing can be measured without a real RevEngAI server or network in the way.
+ *
+ *    For every endpoint it reports throughput, p50/p99 latency, allocations made
+ *    per call and peak RSS of the process.
+ * */
+
+#include "Payloads.h"
+#include "StubServer.h"
+
+#include <Reai/Api.h>
+
+// libc
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// posix
+#include <pthread.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+/* allocation counting */
+
+#if defined(__SANITIZE_ADDRESS__)
+#    define BENCH_HAVE_ASAN 1
+#elif defined(__has_feature)
+#    if __has_feature(address_sanitizer)
+#        define BENCH_HAVE_ASAN 1
+#    endif
+#endif
+
+static u64 alloc_count = 0;
+static u64 alloc_bytes = 0;
+
+// Sanitizers bring their own allocator, and don't like it being replaced.
+#if defined(__GLIBC__) && !defined(BENCH_HAVE_ASAN)
+#    define BENCH_COUNT_ALLOCS 1
+
+extern void* __libc_malloc (size_t n);
+extern void* __libc_calloc (size_t n, size_t s);
+extern void* __libc_realloc (void* p, size_t n);
+
+static inline void CountAlloc (size_t n) {
+    __atomic_fetch_add (&alloc_count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add (&alloc_bytes, n, __ATOMIC_RELAXED);
+}
+
+void* malloc (size_t n) {
+    CountAlloc (n);
+    return __libc_malloc (n);
+}
+
+void* calloc (size_t n, size_t s) {
+    CountAlloc (n * s);
+    return __libc_calloc (n, s);
+}
+
+void* realloc (void* p, size_t n) {
+    CountAlloc (n);
+    return __libc_realloc (p, n);
+}
+#else
+#    define BENCH_COUNT_ALLOCS 0
+#endif
+
+/* benchmark cases */
+
+///
+/// State shared by every call of a case, prepared before timing starts.
+///
+typedef struct BenchInput {
+    FunctionInfos functions; /**< @b For renames. */
+    u8*           upload;    /**< @b For uploads. */
+    size          upload_size;
+} BenchInput;
+
+static BenchInput input = {0};
+
+typedef bool (*BenchCall) (Connection* conn);
+
+static bool BenchAuthenticate (Connection* conn) {
+    return Authenticate (conn);
+}
+
+static bool BenchGetAiModelInfos (Connection* conn) {
+    ModelInfos models = GetAiModelInfos (conn);
+    bool       ok     = models.length > 0;
+    VecDeinit (&models);
+    return ok;
+}
+
+static bool BenchGetBasicFunctionInfo (Connection* conn) {
+    FunctionInfos functions = GetBasicFunctionInfoUsingBinaryId (conn, 1);
+    bool          ok        = functions.length > 0;
+    VecDeinit (&functions);
+    return ok;
+}
+
+static bool BenchGetRecentAnalysis (Connection* conn) {
+    RecentAnalysisRequest request  = RecentAnalysisRequestInit();
+    AnalysisInfos         analyses = GetRecentAnalysis (conn, &request);
+    bool                  ok       = analyses.length > 0;
+    VecDeinit (&analyses);
+    RecentAnalysisRequestDeinit (&request);
+    return ok;
+}
+
+static bool BenchSearchBinary (Connection* conn) {
+    SearchBinaryRequest request = SearchBinaryRequestInit();
+    request.page                = 1;
+    request.page_size           = 100;
+    BinaryInfos binaries        = SearchBinary (conn, &request);
+    bool        ok              = binaries.length > 0;
+    VecDeinit (&binaries);
+    SearchBinaryRequestDeinit (&request);
+    return ok;
+}
+
+static bool BenchSearchCollection (Connection* conn) {
+    SearchCollectionRequest request = SearchCollectionRequestInit();
+    request.page                    = 1;
+    request.page_size               = 100;
+    CollectionInfos collections     = SearchCollection (conn, &request);
+    bool            ok              = collections.length > 0;
+    VecDeinit (&collections);
+    SearchCollectionRequestDeinit (&request);
+    return ok;
+}
+
+static bool BenchGetAnalysisStatus (Connection* conn) {
+    return (GetAnalysisStatus (conn, 1) & STATUS_MASK) == STATUS_COMPLETE;
+}
+
+static bool BenchGetFunctionControlFlowGraph (Connection* conn) {
+    ControlFlowGraph cfg = GetFunctionControlFlowGraph (conn, 1);
+    bool             ok  = cfg.blocks.length > 0;
+    ControlFlowGraphDeinit (&cfg);
+    return ok;
+}
+
+static bool BenchGetSimilarFunctions (Connection* conn) {
+    SimilarFunctionsRequest request = SimilarFunctionsRequestInit();
+    request.function_id             = 1;
+    request.limit                   = 100;
+    SimilarFunctions functions      = GetSimilarFunctions (conn, &request);
+    bool             ok             = functions.length > 0;
+    VecDeinit (&functions);
+    SimilarFunctionsRequestDeinit (&request);
+    return ok;
+}
+
+static bool BenchGetBatchAnnSymbols (Connection* conn) {
+    BatchAnnSymbolRequest request = BatchAnnSymbolRequestInit();
+    request.analysis_id           = 1;
+    request.limit                 = 1;
+    AnnSymbols symbols            = GetBatchAnnSymbols (conn, &request);
+    bool       ok                 = symbols.length > 0;
+    VecDeinit (&symbols);
+    BatchAnnSymbolRequestDeinit (&request);
+    return ok;
+}
+
+static bool BenchGetAiDecompilation (Connection* conn) {
+    AiDecompilation decomp = GetAiDecompilation (conn, 1, true);
+    bool            ok     = decomp.decompilation.length > 0;
+    AiDecompilationDeinit (&decomp);
+    return ok;
+}
+
+static bool BenchBatchRenameFunctions (Connection* conn) {
+    return BatchRenameFunctions (conn, input.functions);
+}
+
+static bool BenchUploadBuffer (Connection* conn) {
+    Str  sha256 = UploadBuffer (conn, input.upload, input.upload_size, "bench.bin");
+    bool ok     = sha256.length > 0;
+    StrDeinit (&sha256);
+    return ok;
+}
+
+typedef struct BenchCase {
+    const char* name;
+    BenchCall   call;
+} BenchCase;
+
+static const BenchCase cases[] = {
+    {"Authenticate",                      BenchAuthenticate               },
+    {"GetAiModelInfos",                   BenchGetAiModelInfos            },
+    {"GetBasicFunctionInfoUsingBinaryId", BenchGetBasicFunctionInfo       },
+    {"GetRecentAnalysis",                 BenchGetRecentAnalysis          },
+    {"SearchBinary",                      BenchSearchBinary               },
+    {"SearchCollection",                  BenchSearchCollection           },
+    {"GetAnalysisStatus",                 BenchGetAnalysisStatus          },
+    {"GetFunctionControlFlowGraph",       BenchGetFunctionControlFlowGraph},
+    {"GetSimilarFunctions",               BenchGetSimilarFunctions        },
+    {"GetBatchAnnSymbols",                BenchGetBatchAnnSymbols         },
+    {"GetAiDecompilation",                BenchGetAiDecompilation         },
+    {"BatchRenameFunctions",              BenchBatchRenameFunctions       },
+    {"UploadBuffer",                      BenchUploadBuffer               },
+};
+
+/* running */
+
+typedef struct Worker {
+    pthread_t   thread;
+    Connection* conn;
+    BenchCall   call;
+    size        iterations;
+    u64*        latencies_ns; /**< @b One per iteration. */
+    size        failures;
+} Worker;
+
+static u64 NowNs() {
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+}
+
+static void* WorkerRun (void* arg) {
+    Worker* w = (Worker*)arg;
+    for (size i = 0; i < w->iterations; i++) {
+        u64 start = NowNs();
+        if (!w->call (w->conn)) {
+            w->failures++;
+        }
+        w->latencies_ns[i] = NowNs() - start;
+    }
+    return NULL;
+}
+
+static int CompareU64 (const void* a, const void* b) {
+    u64 x = *(const u64*)a;
+    u64 y = *(const u64*)b;
+    return (x > y) - (x < y);
+}
+
+static u64 PeakRssKiB() {
+    struct rusage usage;
+    getrusage (RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return (u64)usage.ru_maxrss / 1024; // bytes on macOS
+#else
+    return (u64)usage.ru_maxrss;
+#endif
+}
+
+///
+/// Run one case on `threads` threads, each making `iterations` calls, and print a row.
+///
+/// SUCCESS : true, all calls succeeded.
+/// FAILURE : false, row is still printed.
+///
+static bool RunCase (const BenchCase* bench, Connection* conn, size threads, size iterations) {
+    // first call sets up connection pool, buffers and handles, and is not measured
+    if (!bench->call (conn)) {
+        printf ("%-36s failed on warmup call\n", bench->name);
+        return false;
+    }
+
+    size     calls     = threads * iterations;
+    u64*     latencies = calloc (calls, sizeof (u64));
+    Worker*  workers   = calloc (threads, sizeof (Worker));
+    if (!latencies || !workers) {
+        free (latencies);
+        free (workers);
+        return false;
+    }
+
+    u64 allocs_before = __atomic_load_n (&alloc_count, __ATOMIC_RELAXED);
+    u64 bytes_before  = __atomic_load_n (&alloc_bytes, __ATOMIC_RELAXED);
+    u64 start         = NowNs();
+
+    for (size t = 0; t < threads; t++) {
+        workers[t].conn         = conn;
+        workers[t].call         = bench->call;
+        workers[t].iterations   = iterations;
+        workers[t].latencies_ns = latencies + t * iterations;
+        pthread_create (&workers[t].thread, NULL, WorkerRun, &workers[t]);
+    }
+
+    size failures = 0;
+    for (size t = 0; t < threads; t++) {
+        pthread_join (workers[t].thread, NULL);
+        failures += workers[t].failures;
+    }
+
+    u64 elapsed = NowNs() - start;
+    u64 allocs  = __atomic_load_n (&alloc_count, __ATOMIC_RELAXED) - allocs_before;
+    u64 bytes   = __atomic_load_n (&alloc_bytes, __ATOMIC_RELAXED) - bytes_before;
+
+    qsort (latencies, calls, sizeof (u64), CompareU64);
+    u64 p50 = latencies[calls / 2];
+    u64 p99 = latencies[calls * 99 / 100 < calls ? calls * 99 / 100 : calls - 1];
+
+    printf (
+        "%-36s %8zu %6zu %10.0f %9.1f %9.1f",
+        bench->name,
+        (size_t)calls,
+        (size_t)failures,
+        (f64)calls * 1e9 / (f64)(elapsed ? elapsed : 1),
+        (f64)p50 / 1e3,
+        (f64)p99 / 1e3
+    );
+    if (BENCH_COUNT_ALLOCS) {
+        printf (" %10.1f %10.1f", (f64)allocs / (f64)calls, (f64)bytes / 1024.0 / (f64)calls);
+    } else {
+        printf (" %10s %10s", "-", "-");
+    }
+    printf (" %9.1f\n", (f64)PeakRssKiB() / 1024.0);
+    fflush (stdout);
+
+    free (latencies);
+    free (workers);
+    return !failures;
+}
+
+/* handler backend */
+
+static bool HandleRequest (void* ctx, const ApiRequest* request, Str* response) {
+    // skip scheme and host
+    const char* url    = request->url.data;
+    const char* scheme = strstr (url, "://");
+    const char* path   = strchr (scheme ? scheme + 3 : url, '/');
+    if (!path) {
+        return false;
+    }
+
+    const Str* payload =
+        PayloadsRoute ((Payloads*)ctx, request->method, path, request->url.length - (path - url));
+    if (payload == &((Payloads*)ctx)->not_found) {
+        return false;
+    }
+
+    StrPushBackCstr (response, payload->data, payload->length);
+    return true;
+}
+
+/* main */
+
+static void Usage (const char* argv0) {
+    printf (
+        "Usage: %s [options]\n"
+        "  -c <threads>     Concurrent callers. (default 4)\n"
+        "  -n <elements>    Items in list responses, and KiB uploaded. (default 100)\n"
+        "  -i <iterations>  Calls per caller, per case. (default 200)\n"
+        "  -b <backend>     'http' : local stub server over libcurl, or\n"
+        "                   'handler' : in-process handler, no transport. (default http)\n"
+        "  -f <filter>      Only run cases with this in their name.\n"
+        "  -v               Show library logs on stderr.\n",
+        argv0
+    );
+}
+
+int main (int argc, char** argv) {
+    size        threads    = 4;
+    size        elements   = 100;
+    size        iterations = 200;
+    const char* backend    = "http";
+    const char* filter     = NULL;
+    bool        verbose    = false;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "c:n:i:b:f:vh")) != -1) {
+        switch (opt) {
+            case 'c' :
+                threads = strtoull (optarg, NULL, 10);
+                break;
+            case 'n' :
+                elements = strtoull (optarg, NULL, 10);
+                break;
+            case 'i' :
+                iterations = strtoull (optarg, NULL, 10);
+                break;
+            case 'b' :
+                backend = optarg;
+                break;
+            case 'f' :
+                filter = optarg;
+                break;
+            case 'v' :
+                verbose = true;
+                break;
+            default :
+                Usage (argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    bool use_http = !strcmp (backend, "http");
+    if ((!use_http && strcmp (backend, "handler")) || !threads || !elements || !iterations) {
+        Usage (argv[0]);
+        return 1;
+    }
+
+    // every response is logged, which would be measured as well otherwise
+    if (!verbose && !freopen ("/dev/null", "w", stderr)) {
+        return 1;
+    }
+
+    Payloads payloads;
+    PayloadsInit (&payloads, elements);
+
+    // server is forked before any thread exists
+    StubServer server = {0};
+    if (use_http && !StubServerStart (&server, &payloads)) {
+        printf ("Failed to start stub server.\n");
+        PayloadsDeinit (&payloads);
+        return 1;
+    }
+
+    Connection  conn    = ConnectionInit();
+    ApiBackend* handler = NULL;
+    conn.api_key        = StrInitFromZstr ("bench");
+    conn.user_agent     = StrInitFromZstr ("creait-bench");
+    if (use_http) {
+        conn.host = StrInit();
+        StrPrintf (&conn.host, "http://127.0.0.1:%u", server.port);
+        conn.max_idle_handles = threads;
+    } else {
+        conn.host    = StrInitFromZstr ("http://bench.invalid");
+        handler      = ApiBackendCreateHandler (HandleRequest, &payloads);
+        conn.backend = handler;
+    }
+
+    input.upload_size = elements * 1024;
+    input.upload      = malloc (input.upload_size);
+    for (size i = 0; i < input.upload_size; i++) {
+        input.upload[i] = (u8)(i * 31 + 7);
+    }
+    input.functions = GetBasicFunctionInfoUsingBinaryId (&conn, 1);
+
+    printf (
+        "backend=%s threads=%zu elements=%zu iterations=%zu allocs=%s\n\n",
+        backend,
+        (size_t)threads,
+        (size_t)elements,
+        (size_t)iterations,
+        BENCH_COUNT_ALLOCS ? "counted" : "not counted"
+    );
+    printf (
+        "%-36s %8s %6s %10s %9s %9s %10s %10s %9s\n",
+        "case",
+        "calls",
+        "failed",
+        "calls/s",
+        "p50 us",
+        "p99 us",
+        "allocs",
+        "KiB alloc",
+        "RSS MiB"
+    );
+
+    bool ok = true;
+    for (size c = 0; c < sizeof (cases) / sizeof (cases[0]); c++) {
+        if (filter && !strstr (cases[c].name, filter)) {
+            continue;
+        }
+        ok &= RunCase (&cases[c], &conn, threads, iterations);
+    }
+
+    VecDeinit (&input.functions);
+    free (input.upload);
+    ConnectionDeinit (&conn);
+    ApiBackendDestroy (handler);
+    StubServerStop (&server);
+    PayloadsDeinit (&payloads);
+
+    return ok ? 0 : 1;
+}
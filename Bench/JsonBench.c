@@ -0,0 +1,539 @@
+/**
+ * @file JsonBench.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Microbenchmark of `Json.h` readers, on the same payloads `creait_bench` serves.
+ *    Payloads are read straight out of memory, with no connection, transport or result
+ *    objects in the way, so only reading and skipping of JSON is measured.
+ *
+ *    Readers have the same shape as ones in `Api.c`, but keep strings as views into the
+ *    payload, so that allocations don't hide the cost of matching keys and scanning input.
+ * */
+
+#include "Payloads.h"
+
+#include <Reai/Util/Json.h>
+
+// libc
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// posix
+#include <unistd.h>
+
+/* readers */
+
+///
+/// Read a payload from `j`, and return number of objects found in it.
+/// `sum` gets something added from every object, so the work can't be optimized out.
+///
+typedef size (*JsonRead) (StrIter j, u64* sum);
+
+static size ReadSkip (StrIter j, u64* sum) {
+    StrIter end = JSkipValue (j);
+    *sum        += end.pos;
+    return end.pos != j.pos;
+}
+
+static size ReadFunctions (StrIter j, u64* sum) {
+    size count = 0;
+    bool ok    = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "success", ok);
+        JR_ARR_KV (j, "functions", {
+            u64      id     = 0;
+            u64      length = 0;
+            u64      vaddr  = 0;
+            JStrView name   = JStrViewInit();
+            JR_OBJ (j, {
+                JR_INT_KV (j, "function_id", id);
+                JR_STR_VIEW_KV (j, "function_name", name);
+                JR_INT_KV (j, "function_size", length);
+                JR_INT_KV (j, "function_vaddr", vaddr);
+            });
+            *sum += id + length + vaddr + name.length;
+            count++;
+        });
+    });
+    return ok ? count : 0;
+}
+
+static size ReadRecentAnalyses (StrIter j, u64* sum) {
+    size count = 0;
+    bool ok    = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", ok);
+        JR_OBJ_KV (j, "data", {
+            JR_ARR_KV (j, "results", {
+                u64      analysis_id     = 0;
+                u64      binary_id       = 0;
+                u64      model_id        = 0;
+                u64      binary_size     = 0;
+                u64      task_id         = 0;
+                bool     is_owner        = false;
+                JStrView scope           = JStrViewInit();
+                JStrView status          = JStrViewInit();
+                JStrView creation        = JStrViewInit();
+                JStrView binary_name     = JStrViewInit();
+                JStrView sha256          = JStrViewInit();
+                JStrView username        = JStrViewInit();
+                JStrView dyn_exec_status = JStrViewInit();
+                JR_OBJ (j, {
+                    JR_INT_KV (j, "analysis_id", analysis_id);
+                    JR_STR_VIEW_KV (j, "analysis_scope", scope);
+                    JR_INT_KV (j, "binary_id", binary_id);
+                    JR_INT_KV (j, "model_id", model_id);
+                    JR_STR_VIEW_KV (j, "status", status);
+                    JR_STR_VIEW_KV (j, "creation", creation);
+                    JR_BOOL_KV (j, "is_owner", is_owner);
+                    JR_STR_VIEW_KV (j, "binary_name", binary_name);
+                    JR_STR_VIEW_KV (j, "sha_256_hash", sha256);
+                    JR_INT_KV (j, "binary_size", binary_size);
+                    JR_STR_VIEW_KV (j, "username", username);
+                    JR_STR_VIEW_KV (j, "dynamic_execution_status", dyn_exec_status);
+                    JR_INT_KV (j, "dynamic_execution_task_id", task_id);
+                });
+                *sum += analysis_id + binary_id + model_id + binary_size + task_id + is_owner;
+                *sum += scope.length + status.length + creation.length + binary_name.length;
+                *sum += sha256.length + username.length + dyn_exec_status.length;
+                count++;
+            });
+        });
+    });
+    return ok ? count : 0;
+}
+
+static size ReadSearchCollections (StrIter j, u64* sum) {
+    size count = 0;
+    bool ok    = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", ok);
+        JR_OBJ_KV (j, "data", {
+            JR_ARR_KV (j, "results", {
+                u64      id          = 0;
+                u64      model_id    = 0;
+                u64      length      = 0;
+                u64      team_id     = 0;
+                JStrView name        = JStrViewInit();
+                JStrView scope       = JStrViewInit();
+                JStrView updated     = JStrViewInit();
+                JStrView created     = JStrViewInit();
+                JStrView model_name  = JStrViewInit();
+                JStrView owned_by    = JStrViewInit();
+                JStrView description = JStrViewInit();
+                JStrView tag         = JStrViewInit();
+                JR_OBJ (j, {
+                    JR_INT_KV (j, "collection_id", id);
+                    JR_STR_VIEW_KV (j, "collection_name", name);
+                    JR_STR_VIEW_KV (j, "scope", scope);
+                    JR_STR_VIEW_KV (j, "last_updated_at", updated);
+                    JR_STR_VIEW_KV (j, "created_at", created);
+                    JR_INT_KV (j, "model_id", model_id);
+                    JR_STR_VIEW_KV (j, "model_name", model_name);
+                    JR_STR_VIEW_KV (j, "owned_by", owned_by);
+                    JR_ARR_KV (j, "tags", {
+                        JR_STR_VIEW (j, tag);
+                        *sum += tag.length;
+                    });
+                    JR_INT_KV (j, "size", length);
+                    JR_STR_VIEW_KV (j, "description", description);
+                    JR_INT_KV (j, "team_id", team_id);
+                });
+                *sum += id + model_id + length + team_id + name.length + scope.length;
+                *sum += updated.length + created.length + model_name.length + owned_by.length;
+                *sum += description.length;
+                count++;
+            });
+        });
+    });
+    return ok ? count : 0;
+}
+
+static size ReadControlFlowGraph (StrIter j, u64* sum) {
+    size count = 0;
+    bool ok    = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", ok);
+        JR_OBJ_KV (j, "data", {
+            JR_ARR_KV (j, "blocks", {
+                u64      id       = 0;
+                u64      min_addr = 0;
+                u64      max_addr = 0;
+                JStrView line     = JStrViewInit();
+                JStrView comment  = JStrViewInit();
+                JR_OBJ (j, {
+                    JR_ARR_KV (j, "asm", {
+                        JR_STR_VIEW (j, line);
+                        *sum += line.length;
+                    });
+                    JR_INT_KV (j, "id", id);
+                    JR_INT_KV (j, "min_addr", min_addr);
+                    JR_INT_KV (j, "max_addr", max_addr);
+                    JR_ARR_KV (j, "destinations", {
+                        u64      dest_id  = 0;
+                        JStrView flowtype = JStrViewInit();
+                        JStrView vaddr    = JStrViewInit();
+                        JR_OBJ (j, {
+                            JR_INT_KV (j, "destination_block_id", dest_id);
+                            JR_STR_VIEW_KV (j, "flowtype", flowtype);
+                            JR_STR_VIEW_KV (j, "vaddr", vaddr);
+                        });
+                        *sum += dest_id + flowtype.length + vaddr.length;
+                    });
+                    JR_STR_VIEW_KV (j, "comment", comment);
+                });
+                *sum += id + min_addr + max_addr + comment.length;
+                count++;
+            });
+
+            JR_ARR_KV (j, "local_variables", {
+                u64      length  = 0;
+                JStrView address = JStrViewInit();
+                JStrView d_type  = JStrViewInit();
+                JStrView loc     = JStrViewInit();
+                JStrView name    = JStrViewInit();
+                JR_OBJ (j, {
+                    JR_STR_VIEW_KV (j, "address", address);
+                    JR_STR_VIEW_KV (j, "d_type", d_type);
+                    JR_INT_KV (j, "size", length);
+                    JR_STR_VIEW_KV (j, "loc", loc);
+                    JR_STR_VIEW_KV (j, "name", name);
+                });
+                *sum += length + address.length + d_type.length + loc.length + name.length;
+                count++;
+            });
+        });
+    });
+    return ok ? count : 0;
+}
+
+static size ReadAnnSymbols (StrIter j, u64* sum) {
+    size count = 0;
+    bool ok    = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", ok);
+        JR_OBJ_KV (j, "data", {
+            JR_OBJ (j, {
+                f64      distance      = 0;
+                u64      analysis_id   = 0;
+                u64      binary_id     = 0;
+                bool     debug         = false;
+                JStrView analysis_name = JStrViewInit();
+                JStrView function_name = JStrViewInit();
+                JStrView sha256        = JStrViewInit();
+                JStrView mangled_name  = JStrViewInit();
+                JR_OBJ (j, {
+                    JR_FLT_KV (j, "distance", distance);
+                    JR_INT_KV (j, "nearest_neighbor_analysis_id", analysis_id);
+                    JR_INT_KV (j, "nearest_neighbor_binary_id", binary_id);
+                    JR_STR_VIEW_KV (j, "nearest_neighbor_analysis_name", analysis_name);
+                    JR_STR_VIEW_KV (j, "nearest_neighbor_function_name", function_name);
+                    JR_STR_VIEW_KV (j, "nearest_neighbor_sha_256_hash", sha256);
+                    JR_BOOL_KV (j, "nearest_neighbor_debug", debug);
+                    JR_STR_VIEW_KV (j, "nearest_neighbor_function_name_mangled", mangled_name);
+                });
+                *sum += (u64)(distance * 1000) + analysis_id + binary_id + debug;
+                *sum += analysis_name.length + function_name.length + sha256.length;
+                *sum += mangled_name.length;
+                count++;
+            });
+        });
+    });
+    return ok ? count : 0;
+}
+
+static size ReadAiDecompilation (StrIter j, u64* sum) {
+    size count = 0;
+    bool ok    = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", ok);
+        JR_OBJ_KV (j, "data", {
+            JStrView decompilation = JStrViewInit();
+            JStrView summary       = JStrViewInit();
+            JR_STR_VIEW_KV (j, "decompilation", decompilation);
+            JR_STR_VIEW_KV (j, "ai_summary", summary);
+            *sum += decompilation.length + summary.length;
+
+            JR_OBJ_KV (j, "function_mapping_full", {
+                JR_OBJ_KV (j, "inverse_string_map", {
+                    u64      addr  = 0;
+                    JStrView value = JStrViewInit();
+                    JR_OBJ (j, {
+                        JR_STR_VIEW_KV (j, "string", value);
+                        JR_INT_KV (j, "addr", addr);
+                    });
+                    *sum += addr + value.length;
+                    count++;
+                });
+
+                JR_OBJ_KV (j, "inverse_function_map", {
+                    u64      addr        = 0;
+                    bool     is_external = false;
+                    JStrView name        = JStrViewInit();
+                    JR_OBJ (j, {
+                        JR_STR_VIEW_KV (j, "name", name);
+                        JR_INT_KV (j, "addr", addr);
+                        JR_BOOL_KV (j, "is_external", is_external);
+                    });
+                    *sum += addr + is_external + name.length;
+                    count++;
+                });
+            });
+        });
+    });
+    return ok ? count : 0;
+}
+
+static size ReadIntegers (StrIter j, u64* sum) {
+    size count = 0;
+    JR_ARR (j, {
+        i64 value = 0;
+        JR_INT (j, value);
+        *sum += value;
+        count++;
+    });
+    return count;
+}
+
+static size ReadFloats (StrIter j, u64* sum) {
+    size count = 0;
+    JR_ARR (j, {
+        f64 value = 0;
+        JR_FLT (j, value);
+        *sum += (u64)(value * 1e6);
+        count++;
+    });
+    return count;
+}
+
+///
+/// How `JReadNumber` used to read numbers, kept here to compare against : characters are
+/// copied into a fresh `Str` one at a time, then converted with `strtoll` or `strtod`.
+///
+static StrIter ReadNumberCopied (StrIter si, Number* num) {
+    StrIter saved_si = si;
+    si               = JSkipWhitespace (si);
+
+    Str  ns     = StrInit();
+    bool is_flt = false;
+    while (StrIterRemainingLength (&si)) {
+        char c = StrIterPeek (&si);
+        if (c == '.' || c == 'e' || c == 'E') {
+            is_flt = true;
+        } else if (!(c >= '0' && c <= '9') && c != '-' && c != '+') {
+            break;
+        }
+        StrPushBack (&ns, c);
+        StrIterNext (&si);
+    }
+
+    if (!ns.length) {
+        StrDeinit (&ns);
+        return saved_si;
+    }
+
+    num->is_float = is_flt;
+    if (is_flt) {
+        num->f = strtod (ns.data, NULL);
+    } else {
+        num->i = strtoll (ns.data, NULL, 10);
+    }
+
+    StrDeinit (&ns);
+    return si;
+}
+
+static size ReadIntegersCopied (StrIter j, u64* sum) {
+    size count = 0;
+    JR_ARR (j, {
+        Number num = {0};
+        j          = ReadNumberCopied (j, &num);
+        *sum      += num.i;
+        count++;
+    });
+    return count;
+}
+
+static size ReadFloatsCopied (StrIter j, u64* sum) {
+    size count = 0;
+    JR_ARR (j, {
+        Number num = {0};
+        j          = ReadNumberCopied (j, &num);
+        *sum      += (u64)((num.is_float ? num.f : (f64)num.i) * 1e6);
+        count++;
+    });
+    return count;
+}
+
+/* cases */
+
+typedef struct JsonCase {
+    const char* name;
+    size        payload; /**< @b Offset of payload in `Payloads`. */
+    JsonRead    read;
+} JsonCase;
+
+#define JSON_CASE(n, p, r) {(n), offsetof (Payloads, p), (r)}
+
+static const JsonCase cases[] = {
+    JSON_CASE ("skip/functions", functions, ReadSkip),
+    JSON_CASE ("skip/recent_analyses", recent_analyses, ReadSkip),
+    JSON_CASE ("skip/control_flow_graph", control_flow_graph, ReadSkip),
+    JSON_CASE ("skip/similar_functions", similar_functions, ReadSkip),
+    JSON_CASE ("skip/ann_symbols", ann_symbols, ReadSkip),
+    JSON_CASE ("skip/ai_decompilation", ai_decompilation, ReadSkip),
+    JSON_CASE ("read/functions", functions, ReadFunctions),
+    JSON_CASE ("read/recent_analyses", recent_analyses, ReadRecentAnalyses),
+    JSON_CASE ("read/search_collections", search_collections, ReadSearchCollections),
+    JSON_CASE ("read/control_flow_graph", control_flow_graph, ReadControlFlowGraph),
+    JSON_CASE ("read/ann_symbols", ann_symbols, ReadAnnSymbols),
+    JSON_CASE ("read/ai_decompilation", ai_decompilation, ReadAiDecompilation),
+    JSON_CASE ("number/integers", integers, ReadIntegers),
+    JSON_CASE ("number/integers_copied", integers, ReadIntegersCopied),
+    JSON_CASE ("number/floats", floats, ReadFloats),
+    JSON_CASE ("number/floats_copied", floats, ReadFloatsCopied),
+    JSON_CASE ("number/quoted", quoted_numbers, ReadIntegers),
+};
+
+#undef JSON_CASE
+
+/* running */
+
+static u64 NowNs() {
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+}
+
+///
+/// Read payload of a case once.
+///
+static size ReadCase (const JsonCase* bench, const Str* json, u64* sum) {
+    return bench->read ((StrIter)StrIterInitFromStr (json), sum);
+}
+
+///
+/// Read payload of a case `iterations` times, after one untimed read, and print a row.
+///
+/// SUCCESS : true, every read found same number of objects.
+/// FAILURE : false, row is still printed.
+///
+static bool RunCase (const JsonCase* bench, Payloads* payloads, size iterations) {
+    const Str* json = (const Str*)((const char*)payloads + bench->payload);
+
+    u64  sum     = 0;
+    size objects = ReadCase (bench, json, &sum);
+    bool ok      = objects > 0;
+
+    u64 start = NowNs();
+    for (size i = 0; i < iterations; i++) {
+        ok &= ReadCase (bench, json, &sum) == objects;
+    }
+    u64 elapsed = NowNs() - start;
+    elapsed     = elapsed ? elapsed : 1;
+
+    printf (
+        "%-28s %10zu %8zu %10.1f %10.1f %10.1f%s\n",
+        bench->name,
+        (size_t)json->length,
+        (size_t)objects,
+        (f64)json->length * (f64)iterations * 1e9 / (f64)elapsed / (1024.0 * 1024.0),
+        (f64)elapsed / 1e3 / (f64)iterations,
+        (f64)elapsed / (f64)iterations / (f64)objects,
+        ok ? "" : "  (failed)"
+    );
+    fflush (stdout);
+
+    // keeps reads from being optimized out
+    if (sum == 42) {
+        printf ("\n");
+    }
+
+    return ok;
+}
+
+/* main */
+
+static void Usage (const char* argv0) {
+    printf (
+        "Usage: %s [options]\n"
+        "  -n <elements>    Items in list payloads. (default 1000)\n"
+        "  -i <iterations>  Reads per case. (default 200)\n"
+        "  -f <filter>      Only run cases with this in their name.\n"
+        "  -v               Show library logs on stderr.\n",
+        argv0
+    );
+}
+
+int main (int argc, char** argv) {
+    size        elements   = 1000;
+    size        iterations = 200;
+    const char* filter     = NULL;
+    bool        verbose    = false;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "n:i:f:vh")) != -1) {
+        switch (opt) {
+            case 'n' :
+                elements = strtoull (optarg, NULL, 10);
+                break;
+            case 'i' :
+                iterations = strtoull (optarg, NULL, 10);
+                break;
+            case 'f' :
+                filter = optarg;
+                break;
+            case 'v' :
+                verbose = true;
+                break;
+            default :
+                Usage (argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (!elements || !iterations) {
+        Usage (argv[0]);
+        return 1;
+    }
+
+    // skipped fields are logged, which would be measured as well otherwise
+    if (!verbose && !freopen ("/dev/null", "w", stderr)) {
+        return 1;
+    }
+
+    Payloads payloads;
+    PayloadsInit (&payloads, elements);
+
+    printf (
+        "elements=%zu iterations=%zu scan=%s\n\n",
+        (size_t)elements,
+        (size_t)iterations,
+        JScanKernelName()
+    );
+    printf (
+        "%-28s %10s %8s %10s %10s %10s\n",
+        "case",
+        "bytes",
+        "objects",
+        "MiB/s",
+        "us/read",
+        "ns/object"
+    );
+
+    bool ok = true;
+    for (size c = 0; c < sizeof (cases) / sizeof (cases[0]); c++) {
+        if (filter && !strstr (cases[c].name, filter)) {
+            continue;
+        }
+        ok &= RunCase (&cases[c], &payloads, iterations);
+    }
+
+    PayloadsDeinit (&payloads);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,573 @@
+/**
+ * @file JsonCheck.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Differential checks of JSON reading internals against a reference, run by `ctest`.
+ *    Private sources are built into this program, so they're checked directly instead of
+ *    only through readers in `Json.h`.
+ *
+ *    Numbers are parsed with `JNumberParse` and compared bit for bit with what libc's
+ *    `strtoll` and `strtod` make of the same text, over edge cases, random numbers and
+ *    decimals exactly halfway between two doubles.
+ *
+ *    Every SIMD scan kernel this CPU runs is compared with the scalar one, at every start
+ *    offset and every length up to a few blocks past 32 bytes, with the character looked for
+ *    at every position, at `end` itself, or nowhere.
+ * */
+
+#include "JsonNumber.h"
+#include "JsonScan.h"
+
+#include <Reai/Util/Json.h>
+
+// libc
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// posix
+#include <unistd.h>
+
+/// Mismatches printed per check, rest are only counted.
+#define CHECK_MAX_REPORTS 8
+
+/// Longest number text checked. Exact halfway decimals of subnormals have ~770 digits.
+#define CHECK_MAX_TEXT 1024
+
+typedef struct Check Check;
+
+struct Check {
+    const char* name;
+    void (*run) (Check* check, size count);
+    size checked;
+    size failed;
+};
+
+///
+/// Count one comparison, printing it if it failed and not too many have been printed yet.
+///
+static void
+    CheckReport (Check* check, bool ok, const char* text, const char* got, const char* want) {
+    check->checked++;
+    if (ok) {
+        return;
+    }
+
+    if (check->failed++ < CHECK_MAX_REPORTS) {
+        printf (
+            "%s: '%.64s%s'\n  got  %s\n  want %s\n",
+            check->name,
+            text,
+            strlen (text) > 64 ? "..." : "",
+            got,
+            want
+        );
+    }
+}
+
+/* random */
+
+/// xorshift64*, so that a failing seed reproduces on every libc.
+static u64 rng_state = 0x9e3779b97f4a7c15ull;
+
+static u64 RandU64() {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545f4914f6cdd1dull;
+}
+
+/// Uniform in `[lo, hi]`.
+static i64 RandRange (i64 lo, i64 hi) {
+    return lo + (i64)(RandU64() % (u64)(hi - lo + 1));
+}
+
+/* numbers */
+
+static u64 F64Bits (f64 f) {
+    u64 bits;
+    memcpy (&bits, &f, sizeof (bits));
+    return bits;
+}
+
+static f64 F64FromBits (u64 bits) {
+    f64 f;
+    memcpy (&f, &bits, sizeof (f));
+    return f;
+}
+
+///
+/// Parse `text` with `JNumberParse` and compare with libc. Text with '.', 'e' or 'E' is a
+/// float and compared with `strtod`, anything else with `strtoll`, both clamping on overflow
+/// the same way `JNumberParse` does.
+///
+static void CheckNumber (Check* check, const char* text) {
+    size        length = strlen (text);
+    Number      num    = {0};
+    const char* end    = JNumberParse (text, text + length, &num);
+    bool        is_flt = strpbrk (text, ".eE") != NULL;
+
+    char got[96];
+    char want[96];
+
+    if (end != text + length || num.is_float != is_flt) {
+        snprintf (
+            got,
+            sizeof (got),
+            "%s, %zu of %zu chars",
+            !end ? "rejected" : (num.is_float ? "float" : "integer"),
+            end ? (size_t)(end - text) : (size_t)0,
+            (size_t)length
+        );
+        snprintf (
+            want,
+            sizeof (want),
+            "%s, %zu chars",
+            is_flt ? "float" : "integer",
+            (size_t)length
+        );
+        CheckReport (check, false, text, got, want);
+        return;
+    }
+
+    if (!is_flt) {
+        long long expected = strtoll (text, NULL, 10);
+        snprintf (got, sizeof (got), "%lld", (long long)num.i);
+        snprintf (want, sizeof (want), "%lld", expected);
+        CheckReport (check, num.i == expected, text, got, want);
+        return;
+    }
+
+    f64 expected = strtod (text, NULL);
+    snprintf (got, sizeof (got), "%.17g (0x%016llx)", num.f, (unsigned long long)F64Bits (num.f));
+    snprintf (
+        want,
+        sizeof (want),
+        "%.17g (0x%016llx)",
+        expected,
+        (unsigned long long)F64Bits (expected)
+    );
+    CheckReport (check, F64Bits (num.f) == F64Bits (expected), text, got, want);
+}
+
+static void CheckNumberEdges (Check* check, size count) {
+    (void)count;
+
+    static const char* edges[] = {
+        // integers, clamped outside i64 range
+        "0",
+        "-0",
+        "1",
+        "-1",
+        "9223372036854775806",
+        "9223372036854775807",
+        "9223372036854775808",
+        "-9223372036854775807",
+        "-9223372036854775808",
+        "-9223372036854775809",
+        "18446744073709551615",
+        "18446744073709551616",
+        "-18446744073709551616",
+        "99999999999999999999999999999999",
+        "-99999999999999999999999999999999",
+
+        // floats around 0 and sign
+        "0.0",
+        "-0.0",
+        "0e0",
+        "-0e-5",
+        "0.000000000000000000000000000000000000000000001e-400",
+
+        // subnormals, and halfway between 0 and the smallest one
+        "4.9406564584124654e-324",
+        "5e-324",
+        "2.4703282292062327e-324",
+        "2.4703282292062328e-324",
+        "2.2250738585072009e-308",
+        "2.2250738585072011e-308",
+        "2.2250738585072014e-308",
+        "1e-320",
+        "1e-400",
+
+        // largest double, and overflow to infinity
+        "1.7976931348623157e308",
+        "1.7976931348623158e308",
+        "1.7976931348623159e308",
+        "1e308",
+        "1e309",
+        "-1e309",
+        "1e100000",
+
+        // halfway cases, exact and just off
+        "9007199254740993.0",
+        "9007199254740993.00000000000000000000001",
+        "9007199254740992.99999999999999999999999",
+        "9007199254740995.0",
+        "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124",
+        "1.00000000000000011102230246251565404236316680908203126",
+        "1e23",
+        "8.98846567431158e307",
+
+        // decimals that don't fit 19 digits
+        "0.1",
+        "0.30000000000000004",
+        "3.14159265358979323846264338327950288419716939937510",
+        "123456789012345678901234567890e-10",
+        "0.000000000000000000000000000000000000000000000000000000000001",
+        "1E5",
+        "1e+5",
+        "1.5E-5",
+    };
+
+    for (size i = 0; i < sizeof (edges) / sizeof (edges[0]); i++) {
+        CheckNumber (check, edges[i]);
+    }
+}
+
+static void CheckNumberIntegers (Check* check, size count) {
+    char text[32];
+    for (size i = 0; i < count; i++) {
+        // random length, so that short numbers are as common as ones near the limits
+        i32 digits = (i32)RandRange (1, 21);
+        i32 n      = RandU64() & 1 ? snprintf (text, sizeof (text), "-") : 0;
+        text[n++]  = (char)('1' + RandU64() % 9);
+        while (n < digits + (text[0] == '-')) {
+            text[n++] = (char)('0' + RandU64() % 10);
+        }
+        text[n] = 0;
+        CheckNumber (check, text);
+    }
+}
+
+static void CheckNumberFloats (Check* check, size count) {
+    char text[64];
+    for (size i = 0; i < count; i++) {
+        // any finite double, printed with as many digits as it takes or fewer
+        f64 f = F64FromBits (RandU64());
+        if (!isfinite (f)) {
+            continue;
+        }
+        snprintf (text, sizeof (text), "%.*g", (int)RandRange (1, 17), f);
+        CheckNumber (check, text);
+    }
+}
+
+static void CheckNumberDecimals (Check* check, size count) {
+    char text[80];
+    for (size i = 0; i < count; i++) {
+        // up to 40 digits, so both the fast path and its fallback get taken
+        i32 digits = (i32)RandRange (1, 40);
+        i32 point  = (i32)RandRange (1, digits);
+        i32 n      = RandU64() & 1 ? snprintf (text, sizeof (text), "-") : 0;
+        for (i32 d = 0; d < digits; d++) {
+            if (d == point) {
+                text[n++] = '.';
+            }
+            text[n++] = (char)((d ? '0' : '1') + RandU64() % (d ? 10 : 9));
+        }
+        snprintf (text + n, sizeof (text) - n, "e%d", (int)RandRange (-345, 310));
+        CheckNumber (check, text);
+    }
+}
+
+///
+/// Unsigned integer of up to 800 decimal digits, in base 1e9 limbs, least significant first.
+///
+typedef struct Big {
+    u32 limbs[90];
+    i32 count;
+} Big;
+
+static void BigMul (Big* big, u32 factor) {
+    u64 carry = 0;
+    for (i32 i = 0; i < big->count; i++) {
+        u64 product   = (u64)big->limbs[i] * factor + carry;
+        big->limbs[i] = (u32)(product % 1000000000u);
+        carry         = product / 1000000000u;
+    }
+    while (carry) {
+        big->limbs[big->count++] = (u32)(carry % 1000000000u);
+        carry                   /= 1000000000u;
+    }
+}
+
+/// Write decimal digits of `big`, without leading zeros. Returns number of digits.
+static i32 BigDigits (const Big* big, char* out) {
+    i32 n = sprintf (out, "%u", big->limbs[big->count - 1]);
+    for (i32 i = big->count - 2; i >= 0; i--) {
+        n += sprintf (out + n, "%09u", big->limbs[i]);
+    }
+    return n;
+}
+
+///
+/// Check decimals exactly halfway between a random double and the next one up, which must
+/// round to the one with an even mantissa, and decimals just below and above halfway.
+///
+static void CheckNumberHalfway (Check* check, size count) {
+    char digits[CHECK_MAX_TEXT];
+    char text[CHECK_MAX_TEXT + 32];
+
+    // each of these is hundreds of digits long at the extremes
+    for (size i = 0; i < MAX2 (count / 10, 1); i++) {
+        u64 bits  = RandU64() & ~(1ull << 63);
+        f64 value = F64FromBits (bits);
+        if (!isfinite (value) || !isfinite (nextafter (value, INFINITY))) {
+            continue;
+        }
+
+        // value is m * 2^e, so halfway to next one up is (2m + 1) * 2^(e - 1)
+        u64 mantissa = bits & ((1ull << 52) - 1);
+        i32 exp      = (i32)(bits >> 52);
+        if (exp) {
+            mantissa |= 1ull << 52;
+        } else {
+            exp = 1;
+        }
+        exp -= 1075 + 1;
+
+        // (2m + 1) * 2^exp if exp >= 0, else (2m + 1) * 5^-exp with -exp decimal places
+        Big half = {.count = 0};
+        for (u64 odd = 2 * mantissa + 1; odd; odd /= 1000000000u) {
+            half.limbs[half.count++] = (u32)(odd % 1000000000u);
+        }
+        for (i32 e = 0; e < (exp < 0 ? -exp : exp); e++) {
+            BigMul (&half, exp < 0 ? 5 : 2);
+        }
+
+        i32 n     = BigDigits (&half, digits);
+        i32 exp10 = exp < 0 ? exp : 0;
+        while (digits[n - 1] == '0') {
+            n--;
+            exp10++;
+        }
+        digits[n] = 0;
+
+        // as d.ddd...e<x>, so that value is digits * 10^exp10
+        i32 x = exp10 + n - 1;
+        snprintf (text, sizeof (text), "%c.%se%d", digits[0], n > 1 ? digits + 1 : "0", x);
+        CheckNumber (check, text);
+
+        // just above halfway
+        snprintf (text, sizeof (text), "%c.%s1e%d", digits[0], n > 1 ? digits + 1 : "0", x);
+        CheckNumber (check, text);
+
+        // just below halfway, last digit isn't 0 so taking one off doesn't borrow
+        digits[n - 1]--;
+        if (n > 1) {
+            snprintf (text, sizeof (text), "%c.%s9e%d", digits[0], digits + 1, x);
+        } else {
+            snprintf (text, sizeof (text), "%c.9e%d", digits[0], x);
+        }
+        CheckNumber (check, text);
+    }
+}
+
+/* scanning */
+
+/// Scans start this many different bytes into a block, and run up to this many bytes.
+#define CHECK_SCAN_OFFSETS 32
+#define CHECK_SCAN_LENGTH  80
+
+typedef struct ScanCase {
+    size        kernel;  /**< @b Offset of kernel in `JScanKernels`. */
+    const char* filler;  /**< @b Characters kernel runs over, repeated. */
+    const char* targets; /**< @b Characters kernel stops at. */
+    size        count;   /**< @b Number of targets, which may include NUL. */
+} ScanCase;
+
+///
+/// Scan `[p, p + length)` with all kernels and compare with scalar, which comes first.
+///
+static void CheckScanRun (
+    Check*               check,
+    const ScanCase*      scan,
+    const JScanKernels** kernels,
+    size                 count,
+    const char*          p,
+    size                 length,
+    const char*          what
+) {
+    JScanFn     scalar = *(const JScanFn*)((const char*)kernels[0] + scan->kernel);
+    const char* want   = scalar (p, p + length);
+
+    for (size k = 1; k < count; k++) {
+        JScanFn     kernel = *(const JScanFn*)((const char*)kernels[k] + scan->kernel);
+        const char* got    = kernel (p, p + length);
+
+        char text[96];
+        char got_at[32];
+        char want_at[32];
+        snprintf (
+            text,
+            sizeof (text),
+            "%s, %zu bytes from %zu, %s",
+            kernels[k]->name,
+            (size_t)length,
+            (size_t)((size_t)p % 64),
+            what
+        );
+        snprintf (got_at, sizeof (got_at), "stopped at %zu", (size_t)(got - p));
+        snprintf (want_at, sizeof (want_at), "stopped at %zu", (size_t)(want - p));
+        CheckReport (check, got == want, text, got_at, want_at);
+    }
+}
+
+static void CheckScan (Check* check, const ScanCase* scan) {
+    const JScanKernels* kernels[JSON_SCAN_MAX_KERNELS];
+    size                count = JScanKernelsSupported (kernels);
+
+    // room for targets just past end, and aligned so offsets are offsets into a block
+    _Alignas (64) char block[CHECK_SCAN_OFFSETS + CHECK_SCAN_LENGTH + 64];
+    size               fillers = strlen (scan->filler);
+
+    for (size offset = 0; offset < CHECK_SCAN_OFFSETS; offset++) {
+        for (size length = 0; length <= CHECK_SCAN_LENGTH; length++) {
+            char* p = block + offset;
+            for (size i = 0; i < sizeof (block); i++) {
+                block[i] = scan->filler[i % fillers];
+            }
+
+            CheckScanRun (check, scan, kernels, count, p, length, "nothing to find");
+
+            for (size t = 0; t < scan->count; t++) {
+                char target = scan->targets[t];
+                char what[48];
+
+                // at every position, where a second one later must not be found instead,
+                // and just past end, where it must not be found at all
+                for (size at = 0; at <= length; at++) {
+                    p[at] = target;
+                    if (at + 7 < length) {
+                        p[at + 7] = target;
+                    }
+
+                    snprintf (what, sizeof (what), "0x%02x at %zu", (u8)target, (size_t)at);
+                    CheckScanRun (check, scan, kernels, count, p, length, what);
+
+                    p[at] = scan->filler[(offset + at) % fillers];
+                    if (at + 7 < length) {
+                        p[at + 7] = scan->filler[(offset + at + 7) % fillers];
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void CheckScanString (Check* check, size count) {
+    (void)count;
+    static const char targets[] = {'"', '\\', '\0'};
+    ScanCase          scan      = {
+        offsetof (JScanKernels, string),
+        "abc \x80\xff\x01:,{}[]/",
+        targets,
+        sizeof (targets),
+    };
+    CheckScan (check, &scan);
+}
+
+static void CheckScanSpace (Check* check, size count) {
+    (void)count;
+    static const char targets[] = {'a', '"', '{', '\0', '\x0b', '\x80', (char)(' ' | 0x80)};
+    ScanCase          scan      = {
+        offsetof (JScanKernels, space),
+        " \t\r\n  \n\t",
+        targets,
+        sizeof (targets),
+    };
+    CheckScan (check, &scan);
+}
+
+static void CheckScanStructural (Check* check, size count) {
+    (void)count;
+    static const char targets[] = {'"', '{', '}', '[', ']', '\0'};
+    ScanCase          scan      = {
+        offsetof (JScanKernels, structural),
+        "abc \x80\xff\xdb\xfb\\:,9Z;\x7f\x5c",
+        targets,
+        sizeof (targets),
+    };
+    CheckScan (check, &scan);
+}
+
+/* main */
+
+static void Usage (const char* argv0) {
+    printf (
+        "Usage: %s [options]\n"
+        "  -n <count>   Random inputs per check. (default 100000)\n"
+        "  -s <seed>    Seed of random inputs. (default fixed)\n"
+        "  -f <filter>  Only run checks with this in their name.\n"
+        "  -v           Show library logs on stderr.\n",
+        argv0
+    );
+}
+
+int main (int argc, char** argv) {
+    size        count   = 100000;
+    const char* filter  = NULL;
+    bool        verbose = false;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "n:s:f:vh")) != -1) {
+        switch (opt) {
+            case 'n' :
+                count = strtoull (optarg, NULL, 10);
+                break;
+            case 's' :
+                rng_state = strtoull (optarg, NULL, 0) | 1;
+                break;
+            case 'f' :
+                filter = optarg;
+                break;
+            case 'v' :
+                verbose = true;
+                break;
+            default :
+                Usage (argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    // rejected inputs are logged, mismatches are reported on stdout anyway
+    if (!verbose && !freopen ("/dev/null", "w", stderr)) {
+        return 1;
+    }
+
+    Check checks[] = {
+        {"number/edges", CheckNumberEdges},
+        {"number/integers", CheckNumberIntegers},
+        {"number/floats", CheckNumberFloats},
+        {"number/decimals", CheckNumberDecimals},
+        {"number/halfway", CheckNumberHalfway},
+        {"scan/string", CheckScanString},
+        {"scan/space", CheckScanSpace},
+        {"scan/structural", CheckScanStructural},
+    };
+
+    bool ok = true;
+    for (size c = 0; c < sizeof (checks) / sizeof (checks[0]); c++) {
+        Check* check = &checks[c];
+        if (filter && !strstr (check->name, filter)) {
+            continue;
+        }
+
+        check->run (check, count);
+        printf (
+            "%-24s %10zu checked %8zu failed\n",
+            check->name,
+            (size_t)check->checked,
+            (size_t)check->failed
+        );
+        fflush (stdout);
+        ok &= !check->failed;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,392 @@
+/**
+ * @file Payloads.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include "Payloads.h"
+
+// libc
+#include <string.h>
+
+/// A made up but well formed SHA-256, shared by every payload that needs one.
+#define PAYLOAD_SHA256 "9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08"
+
+static void GenModels (Str* s, size n) {
+    StrPrintf (s, "{\"success\":true,\"models\":[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s{\"model_id\":%zu,\"model_name\":\"binnet-%zu\"}",
+            i ? "," : "",
+            i + 1,
+            i
+        );
+    }
+    StrAppendf (s, "]}");
+}
+
+static void GenFunctions (Str* s, size n) {
+    StrPrintf (s, "{\"success\":true,\"functions\":[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s{\"function_id\":%zu,\"function_name\":\"sub_%zx\",\"function_size\":%zu,"
+            "\"function_vaddr\":%zu}",
+            i ? "," : "",
+            i + 1,
+            0x401000 + i * 0x40,
+            0x40 + i % 512,
+            0x401000 + i * 0x40
+        );
+    }
+    StrAppendf (s, "]}");
+}
+
+static void GenRecentAnalyses (Str* s, size n) {
+    StrPrintf (s, "{\"status\":true,\"data\":{\"results\":[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s{\"analysis_id\":%zu,\"analysis_scope\":\"PRIVATE\",\"binary_id\":%zu,"
+            "\"model_id\":1,\"status\":\"Complete\",\"creation\":\"2026-10-16T10:00:00\","
+            "\"is_owner\":true,\"binary_name\":\"binary-%zu.exe\",\"sha_256_hash\":\"%s\","
+            "\"binary_size\":%zu,\"username\":\"bench\",\"dynamic_execution_status\":\"Complete\","
+            "\"dynamic_execution_task_id\":%zu}",
+            i ? "," : "",
+            i + 1,
+            i + 1,
+            i,
+            PAYLOAD_SHA256,
+            4096 * (i + 1),
+            i
+        );
+    }
+    StrAppendf (s, "]}}");
+}
+
+static void GenSearchBinaries (Str* s, size n) {
+    StrPrintf (s, "{\"status\":true,\"data\":{\"results\":[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s{\"binary_id\":%zu,\"binary_name\":\"binary-%zu.exe\",\"analysis_id\":%zu,"
+            "\"sha_256_hash\":\"%s\",\"tags\":[\"malware\",\"x86_64\"],"
+            "\"created_at\":\"2026-10-16T10:00:00\",\"model_id\":1,\"model_name\":\"binnet-0\","
+            "\"owned_by\":\"bench\"}",
+            i ? "," : "",
+            i + 1,
+            i,
+            i + 1,
+            PAYLOAD_SHA256
+        );
+    }
+    StrAppendf (s, "]}}");
+}
+
+static void GenSearchCollections (Str* s, size n) {
+    StrPrintf (s, "{\"status\":true,\"data\":{\"results\":[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s{\"collection_id\":%zu,\"collection_name\":\"collection-%zu\",\"scope\":\"PUBLIC\","
+            "\"last_updated_at\":\"2026-10-16T10:00:00\",\"created_at\":\"2026-10-16T10:00:00\","
+            "\"model_id\":1,\"model_name\":\"binnet-0\",\"owned_by\":\"bench\","
+            "\"tags\":[\"libc\",\"openssl\"],\"size\":%zu,\"description\":\"Collection %zu\","
+            "\"team_id\":7}",
+            i ? "," : "",
+            i + 1,
+            i,
+            i * 10,
+            i
+        );
+    }
+    StrAppendf (s, "]}}");
+}
+
+static void GenControlFlowGraph (Str* s, size n) {
+    StrPrintf (s, "{\"status\":true,\"data\":{\"blocks\":[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (s, "%s{\"asm\":[", i ? "," : "");
+        for (size l = 0; l < 8; l++) {
+            StrAppendf (s, "%s\"mov rax, qword [rbp - 0x%zx]\"", l ? "," : "", (l + 1) * 8);
+        }
+        StrAppendf (
+            s,
+            "],\"id\":%zu,\"min_addr\":%zu,\"max_addr\":%zu,\"destinations\":["
+            "{\"destination_block_id\":%zu,\"flowtype\":\"true\",\"vaddr\":\"0x%zx\"},"
+            "{\"destination_block_id\":%zu,\"flowtype\":\"false\",\"vaddr\":\"0x%zx\"}],"
+            "\"comment\":\"block %zu\"}",
+            i,
+            0x401000 + i * 0x20,
+            0x401020 + i * 0x20,
+            i + 1,
+            0x401020 + i * 0x20,
+            i + 2,
+            0x401040 + i * 0x20,
+            i
+        );
+    }
+    StrAppendf (s, "],\"local_variables\":[");
+    for (size i = 0; i < n / 4 + 1; i++) {
+        StrAppendf (
+            s,
+            "%s{\"address\":\"0x%zx\",\"d_type\":\"int64_t\",\"size\":8,\"loc\":\"stack\","
+            "\"name\":\"var_%zx\"}",
+            i ? "," : "",
+            (i + 1) * 8,
+            (i + 1) * 8
+        );
+    }
+    StrAppendf (s, "],\"overview_comment\":\"Generated for benchmarking.\"}}");
+}
+
+static void GenSimilarFunctions (Str* s, size n) {
+    StrPrintf (s, "{\"status\":true,\"data\":[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s{\"function_id\":%zu,\"function_name\":\"similar_%zu\",\"binary_id\":%zu,"
+            "\"binary_name\":\"binary-%zu.exe\",\"distance\":0.%03zu,\"projection\":[",
+            i ? "," : "",
+            i + 1,
+            i,
+            i + 1,
+            i,
+            i % 1000
+        );
+        for (size p = 0; p < 8; p++) {
+            StrAppendf (s, "%s%.6f", p ? "," : "", (double)(i + p) / (double)(n + 8));
+        }
+        StrAppendf (s, "],\"sha_256_hash\":\"%s\"}", PAYLOAD_SHA256);
+    }
+    StrAppendf (s, "]}");
+}
+
+static void GenAnnSymbols (Str* s, size n) {
+    StrPrintf (s, "{\"status\":true,\"data\":{");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s\"%zu\":{\"%zu\":{\"distance\":0.%03zu,\"nearest_neighbor_analysis_id\":%zu,"
+            "\"nearest_neighbor_binary_id\":%zu,\"nearest_neighbor_analysis_name\":\"binary-%zu\","
+            "\"nearest_neighbor_function_name\":\"match_%zu\","
+            "\"nearest_neighbor_sha_256_hash\":\"%s\",\"nearest_neighbor_debug\":true,"
+            "\"nearest_neighbor_function_name_mangled\":\"_Z7match_%zuv\"}}",
+            i ? "," : "",
+            i + 1,
+            i + 100000,
+            i % 1000,
+            i + 1,
+            i + 1,
+            i,
+            i,
+            PAYLOAD_SHA256,
+            i
+        );
+    }
+    StrAppendf (s, "}}");
+}
+
+static void GenAiDecompilation (Str* s, size n) {
+    StrPrintf (s, "{\"status\":true,\"data\":{\"decompilation\":\"int main() {\\n");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (s, "    <DISASM_FUNCTION_%zu>(<DISASM_STRING_%zu>);\\n", i, i);
+    }
+    StrAppendf (s, "}\",\"raw_decompilation\":\"\",\"ai_summary\":\"Calls a few functions.\",");
+    StrAppendf (s, "\"raw_ai_summary\":\"\",\"function_mapping_full\":{\"inverse_string_map\":{");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s\"<DISASM_STRING_%zu>\":{\"string\":\"string %zu\",\"addr\":%zu}",
+            i ? "," : "",
+            i,
+            i,
+            0x404000 + i * 16
+        );
+    }
+    StrAppendf (s, "},\"inverse_function_map\":{");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s\"<DISASM_FUNCTION_%zu>\":{\"name\":\"callee_%zu\",\"addr\":%zu,"
+            "\"is_external\":false}",
+            i ? "," : "",
+            i,
+            i,
+            0x401000 + i * 0x40
+        );
+    }
+    StrAppendf (s, "}}}}");
+}
+
+static void GenIntegers (Str* s, size n, bool quoted) {
+    const char* q = quoted ? "\"" : "";
+    StrPrintf (s, "[");
+    for (size i = 0; i < n; i++) {
+        StrAppendf (
+            s,
+            "%s%s%zu%s,%s%zu%s,%s%zu%s,%s%zu%s",
+            i ? "," : "",
+            q,
+            i + 1,
+            q,
+            q,
+            0x401000 + i * 0x40,
+            q,
+            q,
+            0x40 + i % 512,
+            q,
+            q,
+            (size)1700000000000 + i * 7919,
+            q
+        );
+    }
+    StrAppendf (s, "]");
+}
+
+static void GenFloats (Str* s, size n) {
+    // deterministic, but with as many digits as real distances printed by the API have
+    u64 state = 0x9e3779b97f4a7c15;
+    StrPrintf (s, "[");
+    for (size i = 0; i < n; i++) {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        StrAppendf (
+            s,
+            "%s%.17g,%.6f,0.%03zu,%.3e",
+            i ? "," : "",
+            (double)(state >> 11) / (double)((u64)1 << 53),
+            (double)i / (double)(n + 8),
+            i % 1000,
+            (double)(i + 1) * 1e-7
+        );
+    }
+    StrAppendf (s, "]");
+}
+
+void PayloadsInit (Payloads* payloads, size elements) {
+    memset (payloads, 0, sizeof (Payloads));
+    payloads->elements = elements;
+
+    payloads->authenticate    = StrInitFromZstr ("{\"success\":true}");
+    payloads->analysis_status = StrInitFromZstr ("{\"success\":true,\"status\":\"Complete\"}");
+    payloads->status_flag     = StrInitFromZstr ("{\"status\":true}");
+    payloads->not_found       = StrInitFromZstr ("{\"status\":false,\"message\":\"Not found\"}");
+    payloads->ai_decompilation_status =
+        StrInitFromZstr ("{\"status\":true,\"data\":{\"status\":\"SUCCESS\"}}");
+    payloads->upload =
+        StrInitFromZstr ("{\"success\":true,\"sha_256_hash\":\"" PAYLOAD_SHA256 "\"}");
+
+    payloads->models             = StrInit();
+    payloads->functions          = StrInit();
+    payloads->recent_analyses    = StrInit();
+    payloads->search_binaries    = StrInit();
+    payloads->search_collections = StrInit();
+    payloads->control_flow_graph = StrInit();
+    payloads->similar_functions  = StrInit();
+    payloads->ann_symbols        = StrInit();
+    payloads->ai_decompilation   = StrInit();
+
+    GenModels (&payloads->models, elements < 16 ? elements : 16);
+    GenFunctions (&payloads->functions, elements);
+    GenRecentAnalyses (&payloads->recent_analyses, elements);
+    GenSearchBinaries (&payloads->search_binaries, elements);
+    GenSearchCollections (&payloads->search_collections, elements);
+    GenControlFlowGraph (&payloads->control_flow_graph, elements);
+    GenSimilarFunctions (&payloads->similar_functions, elements);
+    GenAnnSymbols (&payloads->ann_symbols, elements);
+    GenAiDecompilation (&payloads->ai_decompilation, elements);
+
+    payloads->integers       = StrInit();
+    payloads->floats         = StrInit();
+    payloads->quoted_numbers = StrInit();
+
+    GenIntegers (&payloads->integers, elements, false);
+    GenFloats (&payloads->floats, elements);
+    GenIntegers (&payloads->quoted_numbers, elements, true);
+}
+
+void PayloadsDeinit (Payloads* payloads) {
+    StrDeinit (&payloads->authenticate);
+    StrDeinit (&payloads->models);
+    StrDeinit (&payloads->functions);
+    StrDeinit (&payloads->recent_analyses);
+    StrDeinit (&payloads->search_binaries);
+    StrDeinit (&payloads->search_collections);
+    StrDeinit (&payloads->analysis_status);
+    StrDeinit (&payloads->control_flow_graph);
+    StrDeinit (&payloads->similar_functions);
+    StrDeinit (&payloads->ann_symbols);
+    StrDeinit (&payloads->ai_decompilation_status);
+    StrDeinit (&payloads->ai_decompilation);
+    StrDeinit (&payloads->status_flag);
+    StrDeinit (&payloads->upload);
+    StrDeinit (&payloads->not_found);
+    StrDeinit (&payloads->integers);
+    StrDeinit (&payloads->floats);
+    StrDeinit (&payloads->quoted_numbers);
+}
+
+static bool StartsWith (const char* s, size n, const char* prefix) {
+    size len = strlen (prefix);
+    return n >= len && !memcmp (s, prefix, len);
+}
+
+static bool EndsWith (const char* s, size n, const char* suffix) {
+    size len = strlen (suffix);
+    return n >= len && !memcmp (s + n - len, suffix, len);
+}
+
+const Str*
+    PayloadsRoute (Payloads* payloads, const char* method, const char* path, size path_length) {
+    // query string does not change the response
+    const char* query = memchr (path, '?', path_length);
+    size        n     = query ? (size)(query - path) : path_length;
+    bool        post  = !strcmp (method, "POST");
+
+    if (StartsWith (path, n, "/v1/authenticate")) {
+        return &payloads->authenticate;
+    }
+    if (StartsWith (path, n, "/v1/models")) {
+        return &payloads->models;
+    }
+    if (StartsWith (path, n, "/v1/analyse/functions/")) {
+        return &payloads->functions;
+    }
+    if (StartsWith (path, n, "/v1/analyse/status/")) {
+        return &payloads->analysis_status;
+    }
+    if (StartsWith (path, n, "/v1/upload")) {
+        return &payloads->upload;
+    }
+    if (StartsWith (path, n, "/v2/analyses/list")) {
+        return &payloads->recent_analyses;
+    }
+    if (StartsWith (path, n, "/v2/search/binaries")) {
+        return &payloads->search_binaries;
+    }
+    if (StartsWith (path, n, "/v2/search/collections")) {
+        return &payloads->search_collections;
+    }
+    if (StartsWith (path, n, "/v2/functions/rename/")) {
+        return &payloads->status_flag;
+    }
+    if (EndsWith (path, n, "/blocks")) {
+        return &payloads->control_flow_graph;
+    }
+    if (EndsWith (path, n, "/similar-functions")) {
+        return &payloads->similar_functions;
+    }
+    if (EndsWith (path, n, "/similarity/functions")) {
+        return &payloads->ann_symbols;
+    }
+    if (EndsWith (path, n, "/ai-decompilation/status")) {
+        return &payloads->ai_decompilation_status;
+    }
+    if (EndsWith (path, n, "/ai-decompilation")) {
+        return post ? &payloads->status_flag : &payloads->ai_decompilation;
+    }
+
+    return &payloads->not_found;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file Payloads.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Canned responses for every endpoint used by `Api.c`, shaped the way the
+ *    parsers expect them, with list payloads scaled to a configurable size.
+ * */
+
+#ifndef REAI_BENCH_PAYLOADS_H
+#define REAI_BENCH_PAYLOADS_H
+
+#include <Reai/Types.h>
+#include <Reai/Util/Str.h>
+
+typedef struct Payloads {
+    size elements; /**< @b Number of items in every list payload. */
+
+    Str authenticate;
+    Str models;
+    Str functions;
+    Str recent_analyses;
+    Str search_binaries;
+    Str search_collections;
+    Str analysis_status;
+    Str control_flow_graph;
+    Str similar_functions;
+    Str ann_symbols;
+    Str ai_decompilation_status;
+    Str ai_decompilation;
+    Str status_flag;
+    Str upload;
+    Str not_found;
+
+    // not served, only read by creait_json_bench
+    Str integers;       /**< @b Array of ids, addresses and sizes. */
+    Str floats;         /**< @b Array of distances and projections. */
+    Str quoted_numbers; /**< @b Array of integers sent as strings. */
+} Payloads;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Generate all payloads.
+    ///
+    /// payloads[out] : Where payloads are stored.
+    /// elements[in]  : Number of items in list payloads (functions, blocks, matches, ...).
+    ///
+    void PayloadsInit (Payloads* payloads, size elements);
+
+    ///
+    /// Free all payloads.
+    ///
+    void PayloadsDeinit (Payloads* payloads);
+
+    ///
+    /// Get canned response for a request.
+    ///
+    /// method[in]      : HTTP method.
+    /// path[in]        : Request path, with or without query string.
+    /// path_length[in] : Length of path.
+    ///
+    /// SUCCESS : Response body. `not_found` payload for unknown endpoints.
+    /// FAILURE : Does not fail.
+    ///
+    const Str*
+        PayloadsRoute (Payloads* payloads, const char* method, const char* path, size path_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_BENCH_PAYLOADS_H
@@ -0,0 +1,334 @@
+/**
+ * @file StubServer.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include "StubServer.h"
+
+#include <Reai/Log.h>
+
+// libc
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+// posix
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#    include <sys/prctl.h>
+#endif
+
+#define STUB_BUFFER_SIZE (64 * 1024)
+
+///
+/// A single keep-alive client connection, served on its own thread.
+/// `buf` holds bytes received but not consumed yet.
+///
+typedef struct Client {
+    int       fd;
+    Payloads* payloads;
+    size      length;
+    char      buf[STUB_BUFFER_SIZE];
+} Client;
+
+static bool Fill (Client* c) {
+    if (c->length == STUB_BUFFER_SIZE) {
+        return false;
+    }
+
+    ssize_t n;
+    do {
+        n = recv (c->fd, c->buf + c->length, STUB_BUFFER_SIZE - c->length, 0);
+    } while (n < 0 && errno == EINTR);
+
+    if (n <= 0) {
+        return false;
+    }
+    c->length += (size)n;
+    return true;
+}
+
+static void Consume (Client* c, size n) {
+    memmove (c->buf, c->buf + n, c->length - n);
+    c->length -= n;
+}
+
+///
+/// Receive until `delim` is in buffer.
+///
+/// end[out] : Offset just past first `delim` in buffer.
+///
+static bool ReadUntil (Client* c, const char* delim, size* end) {
+    size delim_length = strlen (delim);
+    size from         = 0;
+
+    while (true) {
+        for (size i = from; i + delim_length <= c->length; i++) {
+            if (!memcmp (c->buf + i, delim, delim_length)) {
+                *end = i + delim_length;
+                return true;
+            }
+        }
+        from = c->length >= delim_length ? c->length - delim_length + 1 : 0;
+
+        if (!Fill (c)) {
+            return false;
+        }
+    }
+}
+
+///
+/// Receive and throw away next `n` bytes.
+///
+static bool Skip (Client* c, size n) {
+    while (n) {
+        if (!c->length && !Fill (c)) {
+            return false;
+        }
+        size take = n < c->length ? n : c->length;
+        Consume (c, take);
+        n -= take;
+    }
+    return true;
+}
+
+static bool SkipChunkedBody (Client* c) {
+    while (true) {
+        size end;
+        if (!ReadUntil (c, "\r\n", &end)) {
+            return false;
+        }
+        size chunk = strtoull (c->buf, NULL, 16);
+        Consume (c, end);
+
+        // chunk data is followed by CRLF, last (empty) chunk by an empty trailer
+        if (!Skip (c, chunk + 2)) {
+            return false;
+        }
+        if (!chunk) {
+            return true;
+        }
+    }
+}
+
+///
+/// Find value of a header in a NUL terminated header block.
+///
+/// SUCCESS : Pointer to value, up to next CRLF.
+/// FAILURE : NULL if header is not present.
+///
+static const char* HeaderValue (const char* head, const char* name) {
+    size        name_length = strlen (name);
+    const char* line        = strstr (head, "\r\n");
+
+    while (line && line[2]) {
+        line += 2;
+        if (!strncasecmp (line, name, name_length) && line[name_length] == ':') {
+            const char* value = line + name_length + 1;
+            while (*value == ' ' || *value == '\t') {
+                value++;
+            }
+            return value;
+        }
+        line = strstr (line, "\r\n");
+    }
+
+    return NULL;
+}
+
+static bool SendAll (int fd, const char* data, size length, int flags) {
+    while (length) {
+        ssize_t n = send (fd, data, length, flags | MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data   += n;
+        length -= (size)n;
+    }
+    return true;
+}
+
+#ifndef MSG_MORE
+#    define MSG_MORE 0
+#endif
+
+///
+/// Serve one request off the connection.
+///
+/// SUCCESS : true, connection may be kept alive.
+/// FAILURE : false, connection must be closed.
+///
+static bool ServeOne (Client* c) {
+    size head_end;
+    if (!ReadUntil (c, "\r\n\r\n", &head_end)) {
+        return false;
+    }
+
+    // NUL terminate header block, keeping last CRLF of it for HeaderValue
+    char saved            = c->buf[head_end - 2];
+    c->buf[head_end - 2]  = 0;
+    char        method[8] = {0};
+    const char* path      = strchr (c->buf, ' ');
+    const char* path_end  = path ? strchr (path + 1, ' ') : NULL;
+    if (!path_end || (size)(path - c->buf) >= sizeof (method)) {
+        return false;
+    }
+    memcpy (method, c->buf, path - c->buf);
+    path++;
+
+    const char* content_length = HeaderValue (c->buf, "Content-Length");
+    const char* encoding       = HeaderValue (c->buf, "Transfer-Encoding");
+    const char* expect         = HeaderValue (c->buf, "Expect");
+    const char* connection     = HeaderValue (c->buf, "Connection");
+
+    bool chunked    = encoding && !strncasecmp (encoding, "chunked", 7);
+    bool keep_alive = !connection || strncasecmp (connection, "close", 5);
+    u64  body_size  = content_length ? strtoull (content_length, NULL, 10) : 0;
+
+    const Str* payload = PayloadsRoute (c->payloads, method, path, path_end - path);
+
+    c->buf[head_end - 2] = saved;
+    Consume (c, head_end);
+
+    if (expect && !strncasecmp (expect, "100-continue", 12)) {
+        static const char cont[] = "HTTP/1.1 100 Continue\r\n\r\n";
+        if (!SendAll (c->fd, cont, sizeof (cont) - 1, 0)) {
+            return false;
+        }
+    }
+
+    if (chunked ? !SkipChunkedBody (c) : !Skip (c, body_size)) {
+        return false;
+    }
+
+    char head[256];
+    int  head_length = snprintf (
+        head,
+        sizeof (head),
+        "HTTP/1.1 %s\r\nContent-Type: application/json\r\nContent-Length: %zu\r\n%s\r\n",
+        payload == &c->payloads->not_found ? "404 Not Found" : "200 OK",
+        (size_t)payload->length,
+        keep_alive ? "" : "Connection: close\r\n"
+    );
+
+    return SendAll (c->fd, head, head_length, MSG_MORE) &&
+           SendAll (c->fd, payload->data, payload->length, 0) && keep_alive;
+}
+
+static void* ServeClient (void* arg) {
+    Client* c = (Client*)arg;
+    while (ServeOne (c)) {}
+    close (c->fd);
+    free (c);
+    return NULL;
+}
+
+static void Serve (int listener, Payloads* payloads) {
+    while (true) {
+        int fd = accept (listener, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            return;
+        }
+
+        int one = 1;
+        setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof (one));
+
+        Client* c = malloc (sizeof (Client));
+        if (!c) {
+            close (fd);
+            continue;
+        }
+        c->fd       = fd;
+        c->payloads = payloads;
+        c->length   = 0;
+
+        pthread_t tid;
+        if (pthread_create (&tid, NULL, ServeClient, c)) {
+            close (fd);
+            free (c);
+            continue;
+        }
+        pthread_detach (tid);
+    }
+}
+
+bool StubServerStart (StubServer* server, Payloads* payloads) {
+    if (!server || !payloads) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    int listener = socket (AF_INET, SOCK_STREAM, 0);
+    if (listener < 0) {
+        LOG_ERROR ("Failed to create socket : %s", strerror (errno));
+        return false;
+    }
+
+    int one = 1;
+    setsockopt (listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family         = AF_INET;
+    addr.sin_addr.s_addr    = htonl (INADDR_LOOPBACK);
+    addr.sin_port           = 0;
+    socklen_t addr_length   = sizeof (addr);
+
+    if (bind (listener, (struct sockaddr*)&addr, sizeof (addr)) || listen (listener, 1024) ||
+        getsockname (listener, (struct sockaddr*)&addr, &addr_length)) {
+        LOG_ERROR ("Failed to listen on 127.0.0.1 : %s", strerror (errno));
+        close (listener);
+        return false;
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        LOG_ERROR ("Failed to start stub server process : %s", strerror (errno));
+        close (listener);
+        return false;
+    }
+
+    if (!pid) {
+#ifdef __linux__
+        // don't outlive the benchmark if it crashes
+        prctl (PR_SET_PDEATHSIG, SIGKILL);
+#endif
+        signal (SIGPIPE, SIG_IGN);
+        Serve (listener, payloads);
+        _exit (0);
+    }
+
+    // socket is listening already, so connections made from now on just queue up
+    close (listener);
+    server->pid  = pid;
+    server->port = ntohs (addr.sin_port);
+    return true;
+}
+
+void StubServerStop (StubServer* server) {
+    if (!server || server->pid <= 0) {
+        return;
+    }
+
+    kill (server->pid, SIGKILL);
+    waitpid (server->pid, NULL, 0);
+    server->pid = 0;
+}
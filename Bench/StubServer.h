@@ -0,0 +1,47 @@
+/**
+ * @file StubServer.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Minimal HTTP/1.1 server answering every request with a canned payload.
+ *    Runs in a child process, so its allocations and memory don't show up in
+ *    numbers measured for the library.
+ * */
+
+#ifndef REAI_BENCH_STUB_SERVER_H
+#define REAI_BENCH_STUB_SERVER_H
+
+#include "Payloads.h"
+
+typedef struct StubServer {
+    int pid;  /**< @b Process serving requests. */
+    u16 port; /**< @b Port it listens on, on 127.0.0.1. */
+} StubServer;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Fork a process serving given payloads on a free port of 127.0.0.1.
+    /// Must be called before any thread is created in calling process.
+    ///
+    /// server[out]  : Where pid and port of the server are stored.
+    /// payloads[in] : Payloads to serve. Child gets its own copy.
+    ///
+    /// SUCCESS : true, server is accepting connections.
+    /// FAILURE : false, error messages are logged.
+    ///
+    bool StubServerStart (StubServer* server, Payloads* payloads);
+
+    ///
+    /// Kill the server and wait for it to exit.
+    ///
+    void StubServerStop (StubServer* server);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_BENCH_STUB_SERVER_H
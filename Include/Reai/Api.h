@@ -10,6 +10,10 @@
 #ifndef REAI_API_H
 #define REAI_API_H
 
+#include <Reai/Api/Async.h>
+#include <Reai/Api/Backend.h>
+#include <Reai/Api/Connection.h>
+#include <Reai/Api/Poller.h>
 #include <Reai/Api/Types.h>
 #include <Reai/Types.h>
 #include <Reai/Util/Str.h>
@@ -42,14 +46,6 @@ typedef enum OrderBy {
     ORDER_BY_MAX
 } OrderBy;
 
-typedef struct Connection {
-    Str user_agent;
-    Str host;
-    Str api_key;
-} Connection;
-
-#define ConnectionInit() {.host = StrInit(), .api_key = StrInit()}
-
 typedef struct NewAnalysisRequest {
     Str           ai_model;          /**< @b BinNet model to be used */
     Str           platform_opt;      /**< @b Idk the possible values of this enum. */
@@ -139,6 +135,62 @@ typedef struct SimilarFunctionsRequest {
     BinaryIds binary_ids;
 } SimilarFunctionsRequest;
 
+/// Pages fetched ahead by a page iterator, by default and at most.
+#define PAGE_ITER_DEFAULT_PREFETCH 4
+#define PAGE_ITER_MAX_PREFETCH     16
+
+///
+/// Walks all results of a paginated search, one item at a time, fetching next pages
+/// asynchronously while current one is being consumed.
+///
+typedef struct PageIter PageIter;
+
+/// Functions renamed by a single request, when `BatchRenameFunctions*` split up large batches.
+#define BATCH_RENAME_DEFAULT_CHUNK_SIZE 1000
+
+/// Rename requests kept in flight at once by `BatchRenameFunctionsChunked`, by default and at most.
+#define BATCH_RENAME_DEFAULT_MAX_PARALLEL 4
+#define BATCH_RENAME_MAX_PARALLEL         64
+
+///
+/// Outcome of a chunked batch rename, one flag per function, in order functions were given in.
+/// true if function got renamed.
+///
+typedef Vec (bool) RenameResults;
+
+/// Recent analyses an analysis tracker looks through on every refresh, at most. Tracked binaries
+/// not found among them are polled one by one. Nothing is looked through while fewer binaries
+/// are pending than one page of recent analyses holds, they're all just polled.
+#define ANALYSIS_TRACKER_MAX_SCAN 1000
+
+///
+/// A tracked analysis that is no longer pending.
+///
+typedef struct AnalysisEvent {
+    BinaryId   binary_id;
+    AnalysisId analysis_id; /**< @b 0 if completion was found through `GetAnalysisStatus`. */
+    Status     status;      /**< @b Final status, `STATUS_INVALID` if tracking gave up on it. */
+} AnalysisEvent;
+
+///
+/// Waits for many analyses to finish, refreshing their status in bulk from pages of
+/// recent analyses instead of polling each binary on its own.
+///
+typedef struct AnalysisTracker AnalysisTracker;
+
+///
+/// What `UploadFileIfMissing` or `UploadBufferIfMissing` did, and what it cost.
+///
+typedef struct UploadReport {
+    u64  file_size;      /**< @b Size of file (or buffer) in bytes. */
+    u64  hash_ms;        /**< @b Milliseconds spent hashing file locally. */
+    u64  bytes_uploaded; /**< @b File bytes actually sent to server. */
+    u64  bytes_saved;    /**< @b File bytes not sent because server already had them. */
+    bool skipped;        /**< @b Server already had the file, upload was skipped. */
+
+    UploadProgress upload; /**< @b Throughput, chunk latencies and retries of the upload. */
+} UploadReport;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -147,10 +199,14 @@ extern "C" {
     /// Authenticates a connection using the provided API key and host.
     ///
     /// This function constructs the URL for the authentication endpoint (`/v1/authenticate`)
-    /// using the provided host and sends a request via the `MakeRequest` function.
+    /// using the provided host and sends a request via the `ConnectionMakeRequest` function.
     /// If the authentication request is successful, the function returns `true`. If the request fails
     /// due to missing or invalid API key, host, or other errors, it returns `false` and logs an error message.
     ///
+    /// Once authenticated, `warmup_connections` (none by default) keep-alive connections to the
+    /// host are opened (see `ConnectionWarmup`), so calls made right after don't wait for
+    /// connections to be set up.
+    ///
     /// conn[in] : Connection information
     ///
     /// SUCCESS : true
@@ -226,15 +282,41 @@ extern "C" {
 
     ///
     /// Perform a batch function renaming operation for RevEngAI.
+    /// Batches larger than `BATCH_RENAME_DEFAULT_CHUNK_SIZE` are renamed the way
+    /// `BatchRenameFunctionsChunked` does, with default settings.
     ///
     /// conn[in]      : Connection
     /// functions[in] : Functions to be renamed. Only `id` and `symbol.name` field will be used.
     ///
-    /// SUCCESS : true
-    /// FAILURE : false
+    /// SUCCESS : true, all functions renamed.
+    /// FAILURE : false, some (or all) functions weren't renamed.
     ///
     REAI_API bool BatchRenameFunctions (Connection* conn, FunctionInfos functions);
 
+    ///
+    /// Rename a large batch of functions, split into chunks renamed by separate requests, with
+    /// up to `max_parallel` of them in flight at once (over async engine of the connection).
+    /// A failed request only fails functions in its own chunk, and the rest are still renamed.
+    ///
+    /// conn[in]         : Connection
+    /// functions[in]    : Functions to be renamed. Only `id` and `symbol.name` field will be used.
+    /// chunk_size[in]   : Functions per request. 0 means `BATCH_RENAME_DEFAULT_CHUNK_SIZE`.
+    /// max_parallel[in] : Requests in flight at once, at most `BATCH_RENAME_MAX_PARALLEL`.
+    ///                    0 means `BATCH_RENAME_DEFAULT_MAX_PARALLEL`.
+    /// results[out]     : Optional. Initialized here to whether each function got renamed.
+    ///                    Must be deinited with `VecDeinit`.
+    ///
+    /// SUCCESS : Number of functions renamed, same as length of `functions`.
+    /// FAILURE : Fewer functions renamed, error messages are logged.
+    ///
+    REAI_API size BatchRenameFunctionsChunked (
+        Connection*    conn,
+        FunctionInfos  functions,
+        size           chunk_size,
+        size           max_parallel,
+        RenameResults* results
+    );
+
     ///
     /// Rename a single function in RevEngAI.
     ///
@@ -318,6 +400,8 @@ extern "C" {
     ///
     /// This function fetches the decompilation results including generated code
     /// and symbol mappings after successful completion of an AI decompilation job.
+    /// While the job is pending, its status is polled with backoff (see `PollerBackoff`)
+    /// for up to `POLLER_DEFAULT_TIMEOUT_MS`. To wait on many jobs at once, use a `Poller`.
     ///
     /// conn[in]          : Valid connection object
     /// function_id[in]   : ID of the decompiled function
@@ -401,6 +485,384 @@ extern "C" {
     ///
     REAI_API Str UploadFile (Connection* conn, Str file_path);
 
+    ///
+    /// Upload a file for analysis, unless server already has it.
+    ///
+    /// SHA-256 of file is computed locally (file is memory mapped, never read in whole)
+    /// and server is searched for a binary with exactly the same hash. File bytes are
+    /// transferred only if none is found. If search itself fails, file is uploaded anyway.
+    ///
+    /// conn[in]      : Connection information including host and API key.
+    /// file_path[in] : File path of to-be-uploaded file
+    /// report[out]   : Optional. Time spent hashing, and bytes uploaded or saved.
+    ///
+    /// SUCCESS : Str object containing SHA-256 Hash of file.
+    /// FAILURE : Empty Str object.
+    ///
+    REAI_API Str UploadFileIfMissing (Connection* conn, Str file_path, UploadReport* report);
+
+    ///
+    /// Upload data already in memory for analysis, without writing it to a file first.
+    ///
+    /// Data is streamed to server straight from given buffer, without being copied, so it
+    /// may as well be a view of a memory mapped file. Otherwise same as `UploadFile`.
+    ///
+    /// conn[in]   : Connection information including host and API key.
+    /// data[in]   : Data to upload.
+    /// length[in] : Length of data in bytes.
+    /// name[in]   : File name server gets to see for uploaded data.
+    ///
+    /// SUCCESS : Str object containing SHA-256 Hash of uploaded data.
+    /// FAILURE : Empty Str object.
+    ///
+    REAI_API Str UploadBuffer (Connection* conn, const void* data, size length, const char* name);
+
+    ///
+    /// Upload data already in memory for analysis, unless server already has it.
+    /// Same as `UploadFileIfMissing`, except that hash is computed over given buffer.
+    ///
+    /// conn[in]    : Connection information including host and API key.
+    /// data[in]    : Data to upload.
+    /// length[in]  : Length of data in bytes.
+    /// name[in]    : File name server gets to see for uploaded data.
+    /// report[out] : Optional. Time spent hashing, and bytes uploaded or saved.
+    ///
+    /// SUCCESS : Str object containing SHA-256 Hash of data.
+    /// FAILURE : Empty Str object.
+    ///
+    REAI_API Str UploadBufferIfMissing (
+        Connection*   conn,
+        const void*   data,
+        size          length,
+        const char*   name,
+        UploadReport* report
+    );
+
+    ///
+    /// Asynchronous variants of all the API calls above.
+    ///
+    /// Each of these validates its arguments, queues the request on the connection's
+    /// async engine and returns immediately. Output object is zeroed on submission, even if
+    /// request can't be queued, and result is written to it exactly as the blocking variant
+    /// would have returned it, before `callback` is invoked. A request that fails, is
+    /// cancelled or times out leaves it zeroed, so it's always safe to deinit. Output object
+    /// must stay alive until the future completes.
+    ///
+    /// `GetBasicFunctionInfoUsingBinaryIdAsync` initializes its output on submission and
+    /// fills it while response downloads, so it must be deinited even if request fails.
+    ///
+    /// conn[in]      : Connection with host and API key set. Must outlive the request.
+    /// callback[in]  : Optional completion callback, invoked on the engine thread.
+    /// user_data[in] : Passed as is to `callback`.
+    ///
+    /// SUCCESS : A future that must be released using `ApiFutureRelease`.
+    /// FAILURE : `NULL` if request could not be queued, error messages logged.
+    ///
+    REAI_API ApiFuture* AuthenticateAsync (Connection* conn, ApiCallback callback, void* user_data);
+
+    REAI_API ApiFuture* CreateNewAnalysisAsync (
+        Connection*         conn,
+        NewAnalysisRequest* request,
+        BinaryId*           binary_id,
+        ApiCallback         callback,
+        void*               user_data
+    );
+
+    REAI_API ApiFuture* GetBasicFunctionInfoUsingBinaryIdAsync (
+        Connection*    conn,
+        BinaryId       binary_id,
+        FunctionInfos* functions,
+        ApiCallback    callback,
+        void*          user_data
+    );
+
+    REAI_API ApiFuture* GetRecentAnalysisAsync (
+        Connection*            conn,
+        RecentAnalysisRequest* request,
+        AnalysisInfos*         infos,
+        ApiCallback            callback,
+        void*                  user_data
+    );
+
+    REAI_API ApiFuture* SearchBinaryAsync (
+        Connection*          conn,
+        SearchBinaryRequest* request,
+        BinaryInfos*         infos,
+        ApiCallback          callback,
+        void*                user_data
+    );
+
+    REAI_API ApiFuture* SearchCollectionAsync (
+        Connection*              conn,
+        SearchCollectionRequest* request,
+        CollectionInfos*         infos,
+        ApiCallback              callback,
+        void*                    user_data
+    );
+
+    REAI_API ApiFuture* BatchRenameFunctionsAsync (
+        Connection*   conn,
+        FunctionInfos functions,
+        bool*         status,
+        ApiCallback   callback,
+        void*         user_data
+    );
+
+    REAI_API ApiFuture* RenameFunctionAsync (
+        Connection* conn,
+        FunctionId  fn_id,
+        Str         new_name,
+        bool*       status,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    REAI_API ApiFuture* GetBatchAnnSymbolsAsync (
+        Connection*            conn,
+        BatchAnnSymbolRequest* request,
+        AnnSymbols*            syms,
+        ApiCallback            callback,
+        void*                  user_data
+    );
+
+    REAI_API ApiFuture* GetAnalysisStatusAsync (
+        Connection* conn,
+        BinaryId    binary_id,
+        Status*     status,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    REAI_API ApiFuture*
+        GetAiModelInfosAsync (Connection* conn, ModelInfos* models, ApiCallback callback, void* user_data);
+
+    REAI_API ApiFuture* BeginAiDecompilationAsync (
+        Connection* conn,
+        FunctionId  function_id,
+        bool*       status,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    REAI_API ApiFuture* GetAiDecompilationStatusAsync (
+        Connection* conn,
+        FunctionId  function_id,
+        Status*     status,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    ///
+    /// Polls decompilation status and fetches the decompilation once ready,
+    /// all as one chained request on the returned future. Status is polled with the same
+    /// backoff and `POLLER_DEFAULT_TIMEOUT_MS` limit as `GetAiDecompilation`, and the engine
+    /// keeps making other requests while a poll waits for its turn.
+    ///
+    REAI_API ApiFuture* GetAiDecompilationAsync (
+        Connection*      conn,
+        FunctionId       function_id,
+        bool             get_ai_summary,
+        AiDecompilation* decomp,
+        ApiCallback      callback,
+        void*            user_data
+    );
+
+    REAI_API ApiFuture* GetFunctionControlFlowGraphAsync (
+        Connection*       conn,
+        FunctionId        function_id,
+        ControlFlowGraph* cfg,
+        ApiCallback       callback,
+        void*             user_data
+    );
+
+    REAI_API ApiFuture* GetSimilarFunctionsAsync (
+        Connection*              conn,
+        SimilarFunctionsRequest* request,
+        SimilarFunctions*        functions,
+        ApiCallback              callback,
+        void*                    user_data
+    );
+
+    REAI_API ApiFuture* AnalysisIdFromBinaryIdAsync (
+        Connection* conn,
+        BinaryId    binary_id,
+        AnalysisId* analysis_id,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    REAI_API ApiFuture* GetAnalysisLogsAsync (
+        Connection* conn,
+        AnalysisId  analysis_id,
+        Str*        logs,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    REAI_API ApiFuture* UploadFileAsync (
+        Connection* conn,
+        Str         file_path,
+        Str*        sha256,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    ///
+    /// `data` must stay valid until returned future completes.
+    ///
+    REAI_API ApiFuture* UploadBufferAsync (
+        Connection* conn,
+        const void* data,
+        size        length,
+        const char* name,
+        Str*        sha256,
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    ///
+    /// Create an iterator over all results of a paginated call, starting at page (or offset) of
+    /// given request, with pages of its size. Up to `prefetch` following pages are requested
+    /// in advance (over async engine of the connection), so walking through many pages is bound
+    /// by bandwidth rather than by a round-trip per page. Iteration ends at first page with fewer
+    /// items than page size. Destroying an iterator early cancels pages still being fetched.
+    ///
+    ///     PageIter* it = PageIterCreateRecentAnalysis (&conn, &request, 0);
+    ///     for (AnalysisInfo* info; (info = PageIterNextAnalysis (it));) {
+    ///         ...
+    ///     }
+    ///     bool complete = !PageIterFailed (it);
+    ///     PageIterDestroy (it);
+    ///
+    /// conn[in]     : Connection with host and API key set. Must outlive iterator.
+    /// request[in]  : Search to walk through. Copied, but strings and vectors in it are not,
+    ///                so it must outlive iterator.
+    /// prefetch[in] : Pages fetched ahead, at most `PAGE_ITER_MAX_PREFETCH`.
+    ///                0 means `PAGE_ITER_DEFAULT_PREFETCH`.
+    ///
+    /// SUCCESS : Iterator, to be destroyed with `PageIterDestroy`.
+    /// FAILURE : NULL, error messages are logged.
+    ///
+    REAI_API PageIter* PageIterCreateRecentAnalysis (
+        Connection*            conn,
+        RecentAnalysisRequest* request,
+        size                   prefetch
+    );
+
+    REAI_API PageIter*
+        PageIterCreateSearchBinary (Connection* conn, SearchBinaryRequest* request, size prefetch);
+
+    REAI_API PageIter* PageIterCreateSearchCollection (
+        Connection*              conn,
+        SearchCollectionRequest* request,
+        size                     prefetch
+    );
+
+    ///
+    /// Get next item of an iterator, of the type it was created for. Item is owned by iterator,
+    /// and stays valid until next call. To keep it, clone it, or copy the struct and zero the
+    /// item to take ownership of what it holds.
+    ///
+    /// it[in,out] : Iterator to advance.
+    ///
+    /// SUCCESS : Next item.
+    /// FAILURE : NULL once all items have been walked through, or a page failed to download.
+    ///
+    REAI_API AnalysisInfo*   PageIterNextAnalysis (PageIter* it);
+    REAI_API BinaryInfo*     PageIterNextBinary (PageIter* it);
+    REAI_API CollectionInfo* PageIterNextCollection (PageIter* it);
+
+    ///
+    /// Check whether iteration ended because a page failed to download, rather than because
+    /// all results were walked through.
+    ///
+    REAI_API bool PageIterFailed (PageIter* it);
+
+    ///
+    /// Destroy an iterator, cancelling pages still being fetched.
+    ///
+    /// it[in] : Iterator to destroy. May be NULL.
+    ///
+    REAI_API void PageIterDestroy (PageIter* it);
+
+    ///
+    /// Create a tracker for analyses of binaries. Not thread-safe.
+    ///
+    /// Each refresh walks recent analyses of given workspace (newest first, see
+    /// `GetRecentAnalysis`) until every pending binary has been seen or
+    /// `ANALYSIS_TRACKER_MAX_SCAN` analyses have been looked through, and only binaries not seen
+    /// are polled using `GetAnalysisStatus`. Status traffic thus grows with pages of analyses,
+    /// not with number of tracked binaries. While fewer binaries are pending than a page of
+    /// analyses holds, walking is skipped and they're all polled, which takes fewer requests.
+    ///
+    /// Example:
+    ///
+    ///     AnalysisTracker* tracker = AnalysisTrackerCreate (&conn, WORKSPACE_PERSONAL, NULL);
+    ///     VecForeach (&binary_ids, id, { AnalysisTrackerAdd (tracker, id); });
+    ///     for (AnalysisEvent ev; AnalysisTrackerNext (tracker, &ev);) {
+    ///         // ev.binary_id is done, with status ev.status
+    ///     }
+    ///     AnalysisTrackerDestroy (tracker);
+    ///
+    /// conn[in]      : Connection to make requests over. Must outlive the tracker.
+    /// workspace[in] : Workspace tracked binaries were analysed in, whose recent analyses are
+    ///                 looked through. Binaries of other workspaces are polled one by one.
+    /// options[in]   : Backoff between refreshes and per-binary timeout. Defaults of
+    ///                 `PollerOptionsInit()` are used if NULL.
+    ///
+    /// SUCCESS : New tracker, to be destroyed with `AnalysisTrackerDestroy`.
+    /// FAILURE : NULL
+    ///
+    REAI_API AnalysisTracker* AnalysisTrackerCreate (
+        Connection*          conn,
+        Workspace            workspace,
+        const PollerOptions* options
+    );
+
+    ///
+    /// Destroy a tracker. Events not taken out yet are dropped.
+    ///
+    /// tracker[in] : Tracker to destroy. May be NULL.
+    ///
+    REAI_API void AnalysisTrackerDestroy (AnalysisTracker* tracker);
+
+    ///
+    /// Start tracking analysis of a binary. Adding a binary tracked already does nothing.
+    ///
+    /// SUCCESS : true
+    /// FAILURE : false
+    ///
+    REAI_API bool AnalysisTrackerAdd (AnalysisTracker* tracker, BinaryId binary_id);
+
+    ///
+    /// Get number of tracked binaries whose analysis is still pending.
+    ///
+    REAI_API size AnalysisTrackerPending (AnalysisTracker* tracker);
+
+    ///
+    /// Refresh status of all pending binaries once, queueing an event for every analysis
+    /// found to be no longer pending. Doesn't wait between refreshes, `AnalysisTrackerNext`
+    /// does that.
+    ///
+    /// tracker[in,out] : Tracker to refresh.
+    ///
+    /// SUCCESS : true if status of every pending binary could be refreshed.
+    /// FAILURE : false if some requests failed. Binaries refreshed meanwhile still count.
+    ///
+    REAI_API bool AnalysisTrackerRefresh (AnalysisTracker* tracker);
+
+    ///
+    /// Take out next event, refreshing with backoff until one shows up.
+    ///
+    /// tracker[in,out] : Tracker to take event from.
+    /// event[out]      : Where event is stored.
+    ///
+    /// SUCCESS : true, and `event` is filled.
+    /// FAILURE : false once nothing is pending anymore, or if call got cancelled or timed
+    ///           out (see `ConnectionWithOptions`).
+    ///
+    REAI_API bool AnalysisTrackerNext (AnalysisTracker* tracker, AnalysisEvent* event);
+
     ///
     /// Add a URL query parameter to given URL string.
     ///
@@ -459,57 +921,6 @@ extern "C" {
     ///
     REAI_API Str* UrlAddQueryBool (Str* url, const char* key, bool value, bool* is_first);
 
-    ///
-    /// Make an HTTP request to the specified URL with the given method and JSON body.
-    ///
-    /// This function sends an HTTP request using the specified method (e.g., POST, GET), the provided URL,
-    /// and an optional JSON body. The response is then stored in the response_json string object.
-    ///
-    /// request_url[in]    : The URL to which the request should be sent.
-    /// request_json[in]   : JSON string to be sent as the body of the request. Can be NULL if no body is needed.
-    /// response_json[out] : String object to store the response data in JSON format. Can be NULL if response is not required.
-    /// request_method[in] : The HTTP method to use for the request (e.g., "POST", "GET").
-    ///
-    /// RETURNS:
-    /// On success - true
-    /// On failure - false, with log messages printed to log file or stderr.
-    ///
-    REAI_API bool MakeRequest (
-        Str*        user_agent,
-        Str*        api_key,
-        Str*        request_url,
-        Str*        request_json,
-        Str*        response_json,
-        const char* request_method
-    );
-
-    ///
-    /// Make an HTTP request to the specified URL with the given method and JSON body (if provided)
-    /// and a file mimepart data to upload a file at given path.
-    ///
-    /// This function sends an HTTP request using the specified method (e.g., POST, GET), the provided URL,
-    /// and an optional JSON body. The response is then stored in the response_json string object.
-    ///
-    /// request_url[in]    : The URL to which the request should be sent.
-    /// request_json[in]   : JSON string to be sent as the body of the request. Can be NULL if no body is needed.
-    /// response_json[out] : String object to store the response data in JSON format. Can be NULL if response is not required.
-    /// request_method[in] : The HTTP method to use for the request (e.g., "POST", "GET").
-    /// file_path[in]      : File to be uploaded.
-    ///
-    /// RETURNS:
-    /// On success - true
-    /// On failure - false, with log messages printed to log file or stderr.
-    ///
-    REAI_API bool MakeUploadRequest (
-        Str*        user_agent,
-        Str*        api_key,
-        Str*        request_url,
-        Str*        request_json,
-        Str*        response_json,
-        const char* request_method,
-        Str*        file_path
-    );
-
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,170 @@
+/**
+ * @file Async.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Non-blocking requests. Each connection owns one engine thread that drives
+ *    all of its asynchronous requests over a single `curl_multi` handle.
+ *    Number of requests in flight at once is bounded by `max_inflight_requests`
+ *    of the connection, rest wait in a FIFO queue.
+ * */
+
+#ifndef REAI_API_ASYNC_H
+#define REAI_API_ASYNC_H
+
+#include <Reai/Api/Connection.h>
+
+///
+/// Handle to result of an asynchronous request.
+/// Must be released using `ApiFutureRelease` once no longer needed.
+///
+typedef struct ApiFuture ApiFuture;
+
+///
+/// Completion callback. Invoked exactly once per future, on the engine thread,
+/// after output object has been filled. Must not block. Over a backend other than
+/// libcurl it's invoked on thread that made the call, before the call returns.
+///
+/// future[in]    : Completed future. Still owned by caller, do not release it here
+///                 unless caller won't touch it again.
+/// user_data[in] : Pointer provided when request was submitted.
+///
+typedef void (*ApiCallback) (ApiFuture* future, void* user_data);
+
+///
+/// Decides what happens after a response of a chained request arrives.
+///
+typedef enum ApiStep {
+    API_STEP_DONE,   /**< @b Completed successfully. */
+    API_STEP_FAILED, /**< @b Completed with failure. */
+    API_STEP_NEXT    /**< @b `next` request has been filled and must be made on same future,
+                          after its `delay_ms`. */
+} ApiStep;
+
+///
+/// Continuation of a chained request. Invoked on the engine thread after each response.
+///
+/// response[in] : Raw response body of last request.
+/// next[out]    : Request to be made next. Filled only when returning `API_STEP_NEXT`.
+/// ctx[in,out]  : Context pointer provided when request was submitted.
+///
+typedef ApiStep (*ApiContinuation) (Str* response, ApiRequest* next, void* ctx);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Submit a request to be made asynchronously over given connection.
+    /// Ownership of strings in `request` is taken over, and `request` is reset.
+    ///
+    /// conn[in]      : Connection to make request over. Must outlive the request.
+    /// request[in]   : Request to be made.
+    /// parser[in]    : Parser for the response. If NULL and `out` is not NULL then
+    ///                 `out` is treated as a `Str*` and raw response is moved into it.
+    /// out[out]      : Where parsed response is stored. Must stay valid until future is done.
+    /// callback[in]  : Optional completion callback.
+    /// user_data[in] : Passed as is to `callback`.
+    ///
+    /// SUCCESS : A new future.
+    /// FAILURE : `NULL`
+    ///
+    REAI_API ApiFuture* ConnectionSubmit (
+        Connection*       conn,
+        ApiRequest*       request,
+        ApiResponseParser parser,
+        void*             out,
+        ApiCallback       callback,
+        void*             user_data
+    );
+
+    ///
+    /// Submit a chain of requests, where each next request depends on previous response.
+    /// All requests of the chain are made on the same future.
+    ///
+    /// conn[in]         : Connection to make request over. Must outlive the request.
+    /// request[in]      : First request to be made. Taken over and reset.
+    /// continuation[in] : Decides what to do after each response.
+    /// ctx[in]          : Context passed to `continuation`.
+    /// ctx_deinit[in]   : Optional, called on `ctx` once chain completes.
+    /// callback[in]     : Optional completion callback.
+    /// user_data[in]    : Passed as is to `callback`.
+    ///
+    /// SUCCESS : A new future.
+    /// FAILURE : `NULL`, `ctx_deinit` is called before returning.
+    ///
+    REAI_API ApiFuture* ConnectionSubmitChain (
+        Connection*     conn,
+        ApiRequest*     request,
+        ApiContinuation continuation,
+        void*           ctx,
+        void (*ctx_deinit) (void* ctx),
+        ApiCallback callback,
+        void*       user_data
+    );
+
+    ///
+    /// Block until given future completes.
+    ///
+    /// future[in] : Future to wait on.
+    ///
+    /// SUCCESS : true if request succeeded.
+    /// FAILURE : false if request failed or was cancelled.
+    ///
+    REAI_API bool ApiFutureWait (ApiFuture* future);
+
+    ///
+    /// Block until given future completes or timeout expires.
+    ///
+    /// future[in]     : Future to wait on.
+    /// timeout_ms[in] : Max time to wait in milliseconds.
+    ///
+    /// SUCCESS : true if future completed within given time.
+    /// FAILURE : false on timeout.
+    ///
+    REAI_API bool ApiFutureWaitFor (ApiFuture* future, u64 timeout_ms);
+
+    ///
+    /// Check whether future has completed, without blocking.
+    ///
+    REAI_API bool ApiFutureIsDone (ApiFuture* future);
+
+    ///
+    /// Check whether a completed future succeeded. Returns false if it's not done yet.
+    ///
+    REAI_API bool ApiFutureSucceeded (ApiFuture* future);
+
+    ///
+    /// Get body bytes moved by a completed future, summed over all requests of a chain.
+    /// Shows how much compression saved on the wire.
+    ///
+    /// future[in] : Completed future.
+    ///
+    /// SUCCESS : Filled `TransferBytes` object.
+    /// FAILURE : Zeroed `TransferBytes` object if future is not done yet.
+    ///
+    REAI_API TransferBytes ApiFutureGetBytes (ApiFuture* future);
+
+    ///
+    /// Request cancellation of given future. A request that has not started yet
+    /// never starts, a running one is aborted. Future still completes (as failed),
+    /// so callbacks are still invoked and `ApiFutureWait` still returns.
+    ///
+    /// future[in] : Future to cancel.
+    ///
+    REAI_API void ApiFutureCancel (ApiFuture* future);
+
+    ///
+    /// Release caller's reference to given future. A future that is not done yet
+    /// still completes and invokes its callback, but can't be waited on anymore.
+    ///
+    /// future[in] : Future to release.
+    ///
+    REAI_API void ApiFutureRelease (ApiFuture* future);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_API_ASYNC_H
@@ -0,0 +1,97 @@
+/**
+ * @file Backend.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Backends a connection can carry its requests over, instead of talking to
+ *    RevEngAI servers through libcurl. They make it possible to exercise (and benchmark)
+ *    everything above the transport : request building, response parsing, chaining,
+ *    uploads, without network access.
+ *
+ *    Calls made asynchronously over a backend other than libcurl complete on the
+ *    calling thread, before `*Async` function returns.
+ * */
+
+#ifndef REAI_API_BACKEND_H
+#define REAI_API_BACKEND_H
+
+#include <Reai/Api/Connection.h>
+
+///
+/// Serves a request in-process.
+///
+/// ctx[in]       : Pointer given to `ApiBackendCreateHandler`.
+/// request[in]   : Request being made. `file_path`/`upload_data` are set for uploads.
+/// response[out] : Where response body is to be stored. Empty when handler is called.
+///
+/// RETURN : true if request succeeded, false to make it fail like a transport error would.
+///
+typedef bool (*ApiHandler) (void* ctx, const ApiRequest* request, Str* response);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Get the default backend, sending requests to `host` of the connection using libcurl.
+    /// Same as leaving `backend` of a connection NULL. Must not be destroyed.
+    ///
+    /// SUCCESS : Static libcurl backend.
+    /// FAILURE : Does not fail.
+    ///
+    REAI_API ApiBackend* ApiBackendCurl();
+
+    ///
+    /// Create a backend that hands every request to given function on calling thread.
+    ///
+    /// handler[in] : Function serving the requests. Must be thread-safe if connection is
+    ///               used from many threads.
+    /// ctx[in]     : Passed as is to `handler`.
+    ///
+    /// SUCCESS : New backend, to be destroyed with `ApiBackendDestroy`.
+    /// FAILURE : NULL
+    ///
+    REAI_API ApiBackend* ApiBackendCreateHandler (ApiHandler handler, void* ctx);
+
+    ///
+    /// Create a backend that passes every request on to another one, and appends each
+    /// request/response pair to a file for `ApiBackendCreateReplayer` to play back later.
+    /// Host is stripped from recorded URLs, and uploads are recorded by file name only,
+    /// so a recording can be replayed on any machine, with any host.
+    ///
+    /// path[in]  : File to record to. Truncated if it exists.
+    /// inner[in] : Backend actually making the requests. NULL means libcurl.
+    ///             Not owned, must outlive the recorder.
+    ///
+    /// SUCCESS : New backend, to be destroyed with `ApiBackendDestroy`.
+    /// FAILURE : NULL
+    ///
+    REAI_API ApiBackend* ApiBackendCreateRecorder (const char* path, ApiBackend* inner);
+
+    ///
+    /// Create a backend that answers requests from a recording made by a recorder.
+    /// A request gets response of first recorded request with same method, URL (without host),
+    /// body and uploaded file name. Identical requests get their recorded responses in order
+    /// they were recorded in, starting over once all of them have been used, so polling loops
+    /// play back the way they were recorded. Requests never recorded fail.
+    ///
+    /// path[in] : Recording to load. Read completely into memory.
+    ///
+    /// SUCCESS : New backend, to be destroyed with `ApiBackendDestroy`.
+    /// FAILURE : NULL
+    ///
+    REAI_API ApiBackend* ApiBackendCreateReplayer (const char* path);
+
+    ///
+    /// Destroy a backend. No connection may be using it anymore.
+    ///
+    /// backend[in] : Backend to destroy. NULL and libcurl backend are ignored.
+    ///
+    REAI_API void ApiBackendDestroy (ApiBackend* backend);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_API_BACKEND_H
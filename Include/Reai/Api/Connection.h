@@ -0,0 +1,605 @@
+/**
+ * @file Connection.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Connection to RevEngAI servers and the transport used to talk to them.
+ * */
+
+#ifndef REAI_API_CONNECTION_H
+#define REAI_API_CONNECTION_H
+
+#include <Reai/Types.h>
+#include <Reai/Util/JsonStream.h>
+#include <Reai/Util/Str.h>
+
+/// Default number of idle CURL handles a connection keeps alive for reuse.
+#define CONNECTION_DEFAULT_MAX_IDLE_HANDLES 8
+
+/// Default number of asynchronous requests a connection keeps in flight at once.
+#define CONNECTION_DEFAULT_MAX_INFLIGHT_REQUESTS 16
+
+/// Default max number of requests multiplexed over a single HTTP/2 connection.
+#define CONNECTION_DEFAULT_MAX_CONCURRENT_STREAMS 100
+
+/// Default number of idle request/response buffers a connection keeps for reuse.
+#define CONNECTION_DEFAULT_MAX_IDLE_BUFFERS 16
+
+/// Default hedge delay used until enough request latencies are known, and its lower bound after.
+#define CONNECTION_DEFAULT_HEDGE_MIN_DELAY_MS 50
+
+/// Buffers that grew larger than this are freed instead of being kept for reuse.
+#define CONNECTION_MAX_POOLED_BUFFER_SIZE (4 * 1024 * 1024)
+
+/// Default size of chunks file uploads are read and sent in.
+#define CONNECTION_DEFAULT_UPLOAD_CHUNK_SIZE (512 * 1024)
+
+/// Default number of seconds an upload may go without sending anything before it's aborted.
+#define CONNECTION_DEFAULT_UPLOAD_STALL_TIMEOUT 30
+
+/// Default number of times an upload interrupted by a network failure is restarted.
+#define CONNECTION_DEFAULT_UPLOAD_RETRIES 3
+
+/// Default number of keep-alive connections `Authenticate` leaves open to the host. None, since
+/// each one costs another request to the server.
+#define CONNECTION_DEFAULT_WARMUP_CONNECTIONS 0
+
+/// At most this many connections are opened by a single warm-up.
+#define CONNECTION_MAX_WARMUP_CONNECTIONS 32
+
+///
+/// Progress and throughput of a file upload.
+///
+typedef struct UploadProgress {
+    u64 sent;          /**< @b File bytes sent so far by current attempt. */
+    u64 total;         /**< @b Size of file in bytes. */
+    u64 elapsed_ms;    /**< @b Time since current attempt started. */
+    u64 bytes_per_sec; /**< @b Average throughput of current attempt. */
+    u64 chunks;        /**< @b Chunks read from file so far by current attempt. */
+    u64 last_chunk_ms; /**< @b Time taken to send last complete chunk. */
+    u64 max_chunk_ms;  /**< @b Time taken to send slowest chunk. */
+    u32 retries;       /**< @b Attempts restarted after a network failure. */
+} UploadProgress;
+
+///
+/// Invoked while a file upload makes progress, on the thread making the transfer.
+///
+/// progress[in]  : Progress of the upload so far.
+/// user_data[in] : `upload_progress_data` of the connection.
+///
+typedef void (*UploadProgressCallback) (const UploadProgress* progress, void* user_data);
+
+///
+/// Lets calls be cancelled from any thread. Created with `CancelTokenCreate`.
+///
+typedef struct CancelToken CancelToken;
+
+///
+/// Budget of a call, including every request a multi-step call makes, and time spent waiting
+/// for admission control to let a request in (e.g. waiting out a `Retry-After`).
+/// A call that runs out of it fails as soon as possible, and frees the connection.
+///
+typedef struct RequestOptions {
+    u64          deadline; /**< @b Absolute `SysGetMonotonicTimeMs` time to finish by. 0 for none. */
+    CancelToken* cancel;   /**< @b Optional. Must outlive all calls made with these options. */
+} RequestOptions;
+
+#define RequestOptionsInit() {.deadline = 0, .cancel = NULL}
+
+///
+/// Pool of long-lived CURL handles owned by a connection.
+/// Each pooled handle keeps its live (keep-alive) connections to itself. DNS cache and TLS
+/// session cache are not owned by the pool but by a single process-wide cache shared by all
+/// connections and threads, so even a newly created connection doesn't pay for name
+/// resolution and full handshakes again.
+///
+typedef struct ConnectionPool ConnectionPool;
+
+///
+/// What requests of a connection are carried over. Defined below, see `ApiBackend`.
+///
+typedef struct ApiBackend ApiBackend;
+
+typedef struct Connection {
+    Str             user_agent;
+    Str             host;
+    Str             api_key;
+    size            max_idle_handles;      /**< @b Max idle handles kept for reuse. 0 means default. */
+    size            max_inflight_requests; /**< @b Max concurrent async requests. 0 means default. */
+
+    ///
+    /// Multiplex concurrent requests over a single HTTP/2 connection. HTTP/2 is negotiated
+    /// during TLS handshake, and HTTP/1.1 is used if server does not support it.
+    /// When set, all requests (sync ones too) go through the async engine of the connection.
+    /// Must be set before first request is made.
+    ///
+    bool http2;
+    size max_concurrent_streams; /**< @b Max streams per HTTP/2 connection. 0 means default. */
+
+    ///
+    /// Gzip JSON request bodies larger than this many bytes. 0 (default) disables compression.
+    /// Only enable if server accepts `Content-Encoding: gzip`. Ignored without zlib.
+    /// Responses are always compressed if server supports it, and decompressed transparently.
+    ///
+    size compress_requests_above;
+
+    Str ca_bundle; /**< @b CA certificates to verify server with. Empty means system default. */
+
+    ///
+    /// Max idle string buffers kept for reuse by request URLs, bodies and responses.
+    /// In a steady loop of requests this means no allocations for bodies at all. 0 means default.
+    ///
+    size max_idle_buffers;
+
+    ///
+    /// Hedge GET requests to cut tail latency. If no response arrives within this percentile
+    /// (1-99) of recent GET latencies, the same request is sent once more, and whichever copy
+    /// completes first wins while the other one is cancelled. Streamed requests and uploads are
+    /// never hedged. When set, GET requests (sync ones too) go through the async engine.
+    /// 0 (default) disables hedging. Must be set before first request is made.
+    ///
+    u32 hedge_percentile;
+    u32 hedge_min_delay_ms; /**< @b Hedge delay floor, used as is until latencies are known. */
+
+    ///
+    /// Admission control. Every request (sync or async) first waits for a token from a bucket
+    /// refilled at `max_requests_per_sec`, and for a free slot under the concurrency limit.
+    /// With `adaptive_concurrency` the limit starts at 1 and adapts to the server: it grows while
+    /// latency stays flat, and shrinks when latency grows or server answers with HTTP 429.
+    /// Requests answered with HTTP 429 are retried after `Retry-After` has passed.
+    /// Disabled if both are 0 (default). Must be set before first request is made.
+    ///
+    u32  max_requests_per_sec;
+    bool adaptive_concurrency; /**< @b Adapt concurrency limit, up to `max_inflight_requests`. */
+
+    ///
+    /// File uploads are read and sent `upload_chunk_size` bytes at a time, and are not bound by
+    /// the usual request timeout. Instead an upload is aborted if it sends nothing at all for
+    /// `upload_stall_timeout` seconds, and restarted (with backoff) up to `upload_retries` times
+    /// if network fails midway. Chunk size and stall timeout use defaults when 0. Server has no
+    /// way of resuming a partial upload, so a restarted upload is sent from the start.
+    ///
+    size                   upload_chunk_size;
+    u32                    upload_stall_timeout;
+    u32                    upload_retries;
+    UploadProgressCallback upload_progress; /**< @b Optional. Reports progress of uploads. */
+    void*                  upload_progress_data; /**< @b Passed as is to `upload_progress`. */
+
+    ///
+    /// Deadline and cancellation applied to every call made through this connection.
+    /// Usually set on a view made with `ConnectionWithOptions` for a single call. NULL for none.
+    ///
+    const RequestOptions* options;
+
+    ///
+    /// Number of keep-alive connections to the host `Authenticate` opens after it succeeds
+    /// (see `ConnectionWarmup`), so the first calls made after it don't pay for DNS lookups and
+    /// TLS handshakes. `Authenticate` returns only once they're open, and each one is another
+    /// `/v1/authenticate` request to the server. Usually sized from config, e.g. to number of
+    /// calls made at once. 0 (default) disables.
+    ///
+    size warmup_connections;
+
+    ///
+    /// Carries requests of this connection somewhere other than RevEngAI servers, e.g. to an
+    /// in-process handler or a recording on disk (see `Reai/Api/Backend.h`). Not owned, must
+    /// outlive the connection. NULL (default) sends requests over libcurl.
+    ///
+    ApiBackend* backend;
+
+    ConnectionPool* pool; /**< @b Created on first request, freed in ConnectionDeinit. */
+} Connection;
+
+#define ConnectionInit()                                                                           \
+    {.host                    = StrInit(),                                                         \
+     .api_key                 = StrInit(),                                                         \
+     .max_idle_handles        = CONNECTION_DEFAULT_MAX_IDLE_HANDLES,                               \
+     .max_inflight_requests   = CONNECTION_DEFAULT_MAX_INFLIGHT_REQUESTS,                          \
+     .http2                   = false,                                                             \
+     .max_concurrent_streams  = CONNECTION_DEFAULT_MAX_CONCURRENT_STREAMS,                         \
+     .compress_requests_above = 0,                                                                 \
+     .ca_bundle               = StrInit(),                                                         \
+     .max_idle_buffers        = CONNECTION_DEFAULT_MAX_IDLE_BUFFERS,                               \
+     .hedge_percentile        = 0,                                                                 \
+     .hedge_min_delay_ms      = CONNECTION_DEFAULT_HEDGE_MIN_DELAY_MS,                             \
+     .max_requests_per_sec    = 0,                                                                 \
+     .adaptive_concurrency    = false,                                                             \
+     .upload_chunk_size       = CONNECTION_DEFAULT_UPLOAD_CHUNK_SIZE,                              \
+     .upload_stall_timeout    = CONNECTION_DEFAULT_UPLOAD_STALL_TIMEOUT,                           \
+     .upload_retries          = CONNECTION_DEFAULT_UPLOAD_RETRIES,                                 \
+     .upload_progress         = NULL,                                                              \
+     .upload_progress_data    = NULL,                                                              \
+     .options                 = NULL,                                                              \
+     .warmup_connections      = CONNECTION_DEFAULT_WARMUP_CONNECTIONS,                             \
+     .backend                 = NULL,                                                              \
+     .pool                    = NULL}
+
+///
+/// Description of a single HTTP request to be made over a connection.
+///
+typedef struct ApiRequest {
+    Str         url;       /**< @b Complete request URL including query parameters. */
+    Str         body;      /**< @b JSON body. Empty if none. */
+    const char* method;    /**< @b HTTP method, must be a string literal. */
+    Str         file_path; /**< @b If not empty, file is uploaded as multipart data. */
+
+    ///
+    /// If set, these bytes are uploaded instead of a file, straight from memory without being
+    /// copied, and `file_path` only names them. Must stay valid until request completes.
+    ///
+    const void* upload_data;
+    size        upload_size;
+
+    ///
+    /// If set, response is split while it downloads, and each element of top-level array under
+    /// this key is handed to `stream_reader` as soon as it arrives. Response parser then only
+    /// gets to see the rest of the response, with that array left empty.
+    ///
+    const char*       stream_key;
+    JsonElementReader stream_reader; /**< @b Invoked on thread making the transfer. */
+    void*             stream_ctx;    /**< @b Passed as is to `stream_reader`. */
+
+    UploadProgress* upload_stats; /**< @b If set, final stats of file upload are stored here. */
+
+    RequestOptions options; /**< @b Taken from connection when request is made. */
+
+    ///
+    /// Only for next request of a chain (see `ApiContinuation`) : it's made no sooner than this
+    /// many milliseconds after continuation returns it, without holding up anything else.
+    ///
+    u64 delay_ms;
+} ApiRequest;
+
+#define ApiRequestInit()                                                                           \
+    {.url           = StrInit(),                                                                   \
+     .body          = StrInit(),                                                                   \
+     .method        = NULL,                                                                        \
+     .file_path     = StrInit(),                                                                   \
+     .upload_data   = NULL,                                                                        \
+     .upload_size   = 0,                                                                           \
+     .stream_key    = NULL,                                                                        \
+     .stream_reader = NULL,                                                                        \
+     .stream_ctx    = NULL,                                                                        \
+     .upload_stats  = NULL,                                                                        \
+     .options       = RequestOptionsInit(),                                                        \
+     .delay_ms      = 0}
+
+///
+/// Parses a response body into an output object of type known to the parser.
+///
+/// response[in] : Raw response body. Without the streamed array for streamed requests.
+/// out[out]     : Object to store parsed result into. Always initialized by the parser,
+///                except for streamed requests where it's filled while response arrives.
+///
+/// RETURN : true if response indicates success, false otherwise.
+///
+typedef bool (*ApiResponseParser) (Str* response, void* out);
+
+///
+/// Transport interface. Every request made over a connection, sync or async, ends up in one of
+/// these two functions of its backend. A backend that wants to keep state embeds this struct as
+/// its first member.
+///
+/// Both functions block until done, and may be called from many threads at once.
+/// `response` is never NULL, and on failure anything stored in it is discarded.
+///
+struct ApiBackend {
+    const char* name; /**< @b For logs. */
+
+    /// Make a request without a file. Returns true if a successful response was stored.
+    bool (*perform) (ApiBackend* backend, Connection* conn, ApiRequest* request, Str* response);
+
+    /// Upload `file_path`, or `upload_data` named after it if set. Returns same as `perform`.
+    bool (*upload) (ApiBackend* backend, Connection* conn, ApiRequest* request, Str* response);
+
+    /// Free the backend. NULL if there's nothing to free.
+    void (*destroy) (ApiBackend* backend);
+};
+
+///
+/// Body bytes moved by one or more requests, before and after compression.
+///
+typedef struct TransferBytes {
+    u64 sent_wire;        /**< @b Request body bytes put on the wire, after compression. */
+    u64 sent_decoded;     /**< @b Request body bytes before compression. */
+    u64 received_wire;    /**< @b Response body bytes received, before decompression. */
+    u64 received_decoded; /**< @b Response body bytes after decompression. */
+} TransferBytes;
+
+///
+/// Transport statistics collected over lifetime of a connection.
+///
+typedef struct ConnectionStats {
+    u64 requests;        /**< @b Total number of requests made. */
+    u64 failed_requests; /**< @b Requests that failed at transport level. */
+    u64 pool_hits;       /**< @b Requests that reused an idle pooled handle. */
+    u64 pool_misses;     /**< @b Requests that had to create a new handle. */
+
+    u64 new_connections;    /**< @b Requests that had to open a new TCP connection. */
+    u64 reused_connections; /**< @b Requests made over an already open (kept alive) connection. */
+    u64 tls_handshakes;     /**< @b Full or abbreviated TLS handshakes performed. */
+    u64 tls_resumed;        /**< @b Handshakes that resumed a cached TLS session. */
+    u64 http2_requests;     /**< @b Requests that were served over HTTP/2. */
+
+    u64 buffer_hits;   /**< @b Buffers handed out from the idle buffer pool. */
+    u64 buffer_misses; /**< @b Buffers that had to be created empty. */
+
+    u64 hedged_requests; /**< @b Duplicate requests fired. Hedge rate is this over `requests`. */
+    u64 hedge_wins;      /**< @b Duplicates that completed first. Win rate is this over above. */
+
+    u64 throttled_requests; /**< @b Requests server answered with HTTP 429. */
+    u64 concurrency_limit;  /**< @b Current concurrency limit of admission control, 0 if disabled. */
+
+    TransferBytes bytes; /**< @b Body bytes of all completed requests. */
+} ConnectionStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Deinit given connection. Closes all pooled handles and frees all strings held by
+    /// the connection. Live connections stay in process-wide cache for other connections to reuse.
+    ///
+    /// Connection must not be in use by any other thread when this is called.
+    ///
+    /// conn[in,out] : Connection to be deinited.
+    ///
+    REAI_API void ConnectionDeinit (Connection* conn);
+
+    ///
+    /// Get a view of given connection that makes calls with given deadline and cancellation
+    /// token, sharing everything else (handles, buffers, stats, ...) with the connection:
+    ///
+    ///     RequestOptions opts = {.deadline = SysGetMonotonicTimeMs() + 5000, .cancel = token};
+    ///     Connection     view = ConnectionWithOptions (&conn, &opts);
+    ///     AiDecompilation d   = GetAiDecompilation (&view, function_id, true);
+    ///
+    /// View must not be deinited, and must not outlive the connection or the options.
+    ///
+    /// conn[in]    : Connection to make calls over.
+    /// options[in] : Deadline and cancellation of calls made through the view.
+    ///
+    /// SUCCESS : Connection view.
+    /// FAILURE : Copy of connection without options, if `options` is NULL.
+    ///
+    REAI_API Connection ConnectionWithOptions (Connection* conn, const RequestOptions* options);
+
+    ///
+    /// Check whether a call made with given options must stop, because it got cancelled
+    /// or ran past its deadline.
+    ///
+    /// options[in] : Options to check. May be NULL.
+    ///
+    /// RETURN : true if call must stop, false otherwise.
+    ///
+    REAI_API bool RequestOptionsExpired (const RequestOptions* options);
+
+    ///
+    /// Create a new cancellation token, not cancelled yet.
+    ///
+    /// SUCCESS : New token, to be destroyed with `CancelTokenDestroy`.
+    /// FAILURE : Does not return.
+    ///
+    REAI_API CancelToken* CancelTokenCreate();
+
+    ///
+    /// Destroy a token. No call may be using it anymore.
+    ///
+    REAI_API void CancelTokenDestroy (CancelToken* token);
+
+    ///
+    /// Cancel all calls made with given token. Safe to call from any thread.
+    /// Requests in flight are aborted within a second at most, usually sooner.
+    ///
+    REAI_API void CancelTokenCancel (CancelToken* token);
+
+    ///
+    /// Check whether given token has been cancelled.
+    ///
+    REAI_API bool CancelTokenIsCancelled (CancelToken* token);
+
+    ///
+    /// Get a snapshot of transport statistics of given connection.
+    ///
+    /// conn[in] : Connection to get stats for.
+    ///
+    /// SUCCESS : Filled `ConnectionStats` object.
+    /// FAILURE : Zeroed `ConnectionStats` object.
+    ///
+    REAI_API ConnectionStats ConnectionGetStats (Connection* conn);
+
+    ///
+    /// Get connections to the host ready before they're needed. Resolves the host, and opens
+    /// given number of keep-alive connections at once with a lightweight request over each,
+    /// one per pooled handle, so following sync requests made over those handles find them open.
+    /// TLS sessions and DNS entries go to process-wide cache, so handshakes of any other
+    /// connection (async ones included) are resumed, not made from scratch. With `http2` a single
+    /// connection is opened by the async engine instead, since it carries every request anyway.
+    /// Each request takes a token of admission control like any other, but never waits for one :
+    /// only as many connections as it lets in right away are opened. Counts in stats like any
+    /// request. At most `max_idle_handles` connections are opened, since pool keeps no more.
+    ///
+    /// Servers close idle connections after a while, so warm up shortly before they're used.
+    /// Nothing is done for connections carrying requests over a backend other than libcurl.
+    ///
+    /// conn[in]        : Connection to warm up. Deadline and cancellation token of its options
+    ///                   apply, if any.
+    /// connections[in] : Number of connections to have open, at most `max_idle_handles` and
+    ///                   `CONNECTION_MAX_WARMUP_CONNECTIONS`.
+    ///
+    /// SUCCESS : true, all connections are open.
+    /// FAILURE : false if some could not be opened, error messages are logged.
+    ///
+    REAI_API bool ConnectionWarmup (Connection* conn, size connections);
+
+    ///
+    /// Deinit given request object.
+    ///
+    /// req[in,out] : Request to be deinited.
+    ///
+    REAI_API void ApiRequestDeinit (ApiRequest* req);
+
+    ///
+    /// Take a cleared string buffer from idle buffer pool of given connection.
+    /// Buffer keeps capacity from its previous use, so filling it usually does not allocate.
+    ///
+    /// conn[in] : Connection to take buffer from. If NULL, an empty buffer is returned.
+    ///
+    /// SUCCESS : Empty `Str` object, possibly with some capacity reserved.
+    /// FAILURE : Does not fail.
+    ///
+    REAI_API Str ConnectionAcquireBuffer (Connection* conn);
+
+    ///
+    /// Give a buffer back to idle buffer pool of given connection for reuse.
+    /// Buffer is freed instead if pool is full or buffer grew too large.
+    /// Given buffer is left in initialized (empty) state either way.
+    ///
+    /// conn[in]    : Connection buffer is given back to. If NULL, buffer is freed.
+    /// buf[in,out] : Buffer to be given back.
+    ///
+    REAI_API void ConnectionReleaseBuffer (Connection* conn, Str* buf);
+
+    ///
+    /// Create a request with url and body buffers taken from idle buffer pool of connection.
+    ///
+    /// conn[in] : Connection to take buffers from. If NULL, same as `ApiRequestInit()`.
+    ///
+    /// SUCCESS : Initialized request object.
+    /// FAILURE : Does not fail.
+    ///
+    REAI_API ApiRequest ConnectionAcquireRequest (Connection* conn);
+
+    ///
+    /// Give url and body buffers of request back to idle buffer pool of connection,
+    /// and deinit rest of the request.
+    ///
+    /// conn[in]    : Connection buffers are given back to. If NULL, same as `ApiRequestDeinit`.
+    /// req[in,out] : Request to be released.
+    ///
+    REAI_API void ConnectionReleaseRequest (Connection* conn, ApiRequest* req);
+
+    ///
+    /// Make given request over given connection and parse the response, blocking until done.
+    ///
+    /// conn[in]    : Connection to make request over.
+    /// request[in] : Request to be made.
+    /// parser[in]  : Parser for the response. If NULL and `out` is not NULL then
+    ///               `out` is treated as a `Str*` and raw response is moved into it.
+    /// out[out]    : Where parsed response is stored. Can be NULL if response is not required.
+    ///
+    /// SUCCESS : true if request was made and `parser` reported success.
+    /// FAILURE : false
+    ///
+    REAI_API bool
+        ConnectionPerform (Connection* conn, ApiRequest* request, ApiResponseParser parser, void* out);
+
+    ///
+    /// Make an HTTP request to the specified URL using handles pooled in given connection.
+    ///
+    /// Same as `MakeRequest`, except that the CURL handle used to make the request is taken from
+    /// (and returned back to) the connection's handle pool, keeping connections alive between
+    /// calls. Safe to call from multiple threads using the same connection.
+    ///
+    /// conn[in]           : Connection with user agent and API key set.
+    /// request_url[in]    : The URL to which the request should be sent.
+    /// request_json[in]   : JSON string to be sent as the body of the request. Can be NULL if no body is needed.
+    /// response_json[out] : String object to store the response data in JSON format. Can be NULL if response is not required.
+    /// request_method[in] : The HTTP method to use for the request (e.g., "POST", "GET").
+    ///
+    /// RETURNS:
+    /// On success - true
+    /// On failure - false, with log messages printed to log file or stderr.
+    ///
+    REAI_API bool ConnectionMakeRequest (
+        Connection* conn,
+        Str*        request_url,
+        Str*        request_json,
+        Str*        response_json,
+        const char* request_method
+    );
+
+    ///
+    /// Make a file upload request using handles pooled in given connection.
+    /// Same as `MakeUploadRequest`, except that the CURL handle is reused from connection's pool.
+    ///
+    /// conn[in]           : Connection with user agent and API key set.
+    /// request_url[in]    : The URL to which the request should be sent.
+    /// request_json[in]   : JSON string to be sent as the body of the request. Can be NULL if no body is needed.
+    /// response_json[out] : String object to store the response data in JSON format. Can be NULL if response is not required.
+    /// request_method[in] : The HTTP method to use for the request (e.g., "POST", "GET").
+    /// file_path[in]      : File to be uploaded.
+    ///
+    /// RETURNS:
+    /// On success - true
+    /// On failure - false, with log messages printed to log file or stderr.
+    ///
+    REAI_API bool ConnectionMakeUploadRequest (
+        Connection* conn,
+        Str*        request_url,
+        Str*        request_json,
+        Str*        response_json,
+        const char* request_method,
+        Str*        file_path
+    );
+
+    ///
+    /// Make an HTTP request to the specified URL with the given method and JSON body.
+    ///
+    /// This function sends an HTTP request using the specified method (e.g., POST, GET), the provided URL,
+    /// and an optional JSON body. The response is then stored in the response_json string object.
+    /// A fresh handle is created for each call. Prefer `ConnectionMakeRequest` to reuse connections.
+    ///
+    /// request_url[in]    : The URL to which the request should be sent.
+    /// request_json[in]   : JSON string to be sent as the body of the request. Can be NULL if no body is needed.
+    /// response_json[out] : String object to store the response data in JSON format. Can be NULL if response is not required.
+    /// request_method[in] : The HTTP method to use for the request (e.g., "POST", "GET").
+    ///
+    /// RETURNS:
+    /// On success - true
+    /// On failure - false, with log messages printed to log file or stderr.
+    ///
+    REAI_API bool MakeRequest (
+        Str*        user_agent,
+        Str*        api_key,
+        Str*        request_url,
+        Str*        request_json,
+        Str*        response_json,
+        const char* request_method
+    );
+
+    ///
+    /// Make an HTTP request to the specified URL with the given method and JSON body (if provided)
+    /// and a file mimepart data to upload a file at given path.
+    ///
+    /// This function sends an HTTP request using the specified method (e.g., POST, GET), the provided URL,
+    /// and an optional JSON body. The response is then stored in the response_json string object.
+    /// A fresh handle is created for each call. Prefer `ConnectionMakeUploadRequest` to reuse connections.
+    ///
+    /// request_url[in]    : The URL to which the request should be sent.
+    /// request_json[in]   : JSON string to be sent as the body of the request. Can be NULL if no body is needed.
+    /// response_json[out] : String object to store the response data in JSON format. Can be NULL if response is not required.
+    /// request_method[in] : The HTTP method to use for the request (e.g., "POST", "GET").
+    /// file_path[in]      : File to be uploaded.
+    ///
+    /// RETURNS:
+    /// On success - true
+    /// On failure - false, with log messages printed to log file or stderr.
+    ///
+    REAI_API bool MakeUploadRequest (
+        Str*        user_agent,
+        Str*        api_key,
+        Str*        request_url,
+        Str*        request_json,
+        Str*        response_json,
+        const char* request_method,
+        Str*        file_path
+    );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_API_CONNECTION_H
@@ -0,0 +1,160 @@
+/**
+ * @file Poller.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Waits for many analyses and AI decompilations to finish at once. A single scheduler
+ *    thread polls status of every tracked item, backing off exponentially (with jitter)
+ *    while it stays pending, and makes the polls asynchronously over the connection's
+ *    engine. No thread is blocked per item, so thousands of items can be waited on.
+ * */
+
+#ifndef REAI_API_POLLER_H
+#define REAI_API_POLLER_H
+
+#include <Reai/Api/Async.h>
+#include <Reai/Api/Types/Common.h>
+#include <Reai/Api/Types/Status.h>
+
+/// Default wait before second status poll of an item. First poll is made right away.
+#define POLLER_DEFAULT_INITIAL_DELAY_MS 500
+
+/// Default upper bound of wait between two status polls of an item.
+#define POLLER_DEFAULT_MAX_DELAY_MS 16000
+
+/// Default time after which an item still pending is given up on.
+#define POLLER_DEFAULT_TIMEOUT_MS (10 * 60 * 1000)
+
+/// Consecutive failed status polls after which an item is given up on.
+#define POLLER_MAX_FAILURES 5
+
+typedef struct PollerOptions {
+    u64 initial_delay_ms; /**< @b Wait before second poll, doubled after every pending poll. */
+    u64 max_delay_ms;     /**< @b Upper bound of wait between two polls. */
+    u64 timeout_ms;       /**< @b Give up on an item pending for this long. 0 for never. */
+} PollerOptions;
+
+#define PollerOptionsInit()                                                                        \
+    {.initial_delay_ms = POLLER_DEFAULT_INITIAL_DELAY_MS,                                          \
+     .max_delay_ms     = POLLER_DEFAULT_MAX_DELAY_MS,                                              \
+     .timeout_ms       = POLLER_DEFAULT_TIMEOUT_MS}
+
+///
+/// What is being waited for. Decides which status call polls it, and what its id is.
+///
+typedef enum PollKind {
+    POLL_KIND_ANALYSIS,         /**< @b `GetAnalysisStatus`, id is a `BinaryId`. */
+    POLL_KIND_AI_DECOMPILATION, /**< @b `GetAiDecompilationStatus`, id is a `FunctionId`. */
+} PollKind;
+
+typedef struct Poller Poller;
+
+///
+/// Invoked exactly once per tracked item, on the scheduler thread, once it's no longer pending.
+/// May add more items to the poller, but must not destroy it.
+///
+/// kind[in]      : What was polled.
+/// id[in]        : Binary or function id given when item was added.
+/// status[in]    : Final status, as returned by the status call. `STATUS_INVALID` if polling
+///                 gave up (timeout, repeated failures, or poller got destroyed).
+/// user_data[in] : Pointer provided when item was added.
+///
+typedef void (*PollCallback) (PollKind kind, u64 id, Status status, void* user_data);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Create a poller and start its scheduler thread.
+    ///
+    /// conn[in]    : Connection to make status polls over. Must outlive the poller.
+    ///               A view from `ConnectionWithOptions` bounds every poll by its options.
+    /// options[in] : Optional, defaults of `PollerOptionsInit()` are used if NULL.
+    ///
+    /// SUCCESS : New poller, to be destroyed with `PollerDestroy`.
+    /// FAILURE : NULL
+    ///
+    REAI_API Poller* PollerCreate (Connection* conn, const PollerOptions* options);
+
+    ///
+    /// Stop polling and destroy the poller. Callbacks of items still pending are invoked
+    /// with `STATUS_INVALID` before this returns. Must not be called from a callback.
+    ///
+    /// poller[in] : Poller to be destroyed.
+    ///
+    REAI_API void PollerDestroy (Poller* poller);
+
+    ///
+    /// Start tracking an analysis, until it completes or errors out.
+    ///
+    /// poller[in]    : Poller to track it with.
+    /// binary_id[in] : Binary id of analysis.
+    /// callback[in]  : Invoked once analysis is no longer pending.
+    /// user_data[in] : Passed as is to `callback`.
+    ///
+    /// SUCCESS : true
+    /// FAILURE : false, callback won't be invoked.
+    ///
+    REAI_API bool PollerAddAnalysis (
+        Poller*      poller,
+        BinaryId     binary_id,
+        PollCallback callback,
+        void*        user_data
+    );
+
+    ///
+    /// Start tracking an AI decompilation, until it completes or errors out.
+    /// Decompilation must have been started with `BeginAiDecompilation` already.
+    ///
+    /// poller[in]      : Poller to track it with.
+    /// function_id[in] : Function being decompiled.
+    /// callback[in]    : Invoked once decompilation is no longer pending.
+    /// user_data[in]   : Passed as is to `callback`.
+    ///
+    /// SUCCESS : true
+    /// FAILURE : false, callback won't be invoked.
+    ///
+    REAI_API bool PollerAddAiDecompilation (
+        Poller*      poller,
+        FunctionId   function_id,
+        PollCallback callback,
+        void*        user_data
+    );
+
+    ///
+    /// Get number of tracked items whose callback hasn't returned yet.
+    ///
+    REAI_API size PollerPending (Poller* poller);
+
+    ///
+    /// Block until every tracked item is done and its callback has returned.
+    ///
+    /// poller[in]     : Poller to wait on.
+    /// timeout_ms[in] : Max time to wait in milliseconds. 0 to wait forever.
+    ///
+    /// SUCCESS : true if nothing is pending anymore.
+    /// FAILURE : false on timeout.
+    ///
+    REAI_API bool PollerWait (Poller* poller, u64 timeout_ms);
+
+    ///
+    /// Get wait before next status poll, when `attempt` polls have found an item pending.
+    /// Doubles with every attempt up to `max_delay_ms`, and is jittered by up to 25% either
+    /// way so items added together don't keep polling together.
+    ///
+    /// options[in] : Backoff to follow.
+    /// attempt[in] : Number of polls made so far that found item pending. At least 1.
+    /// seed[in]    : Anything that tells items apart, for example their id.
+    ///
+    /// SUCCESS : Wait in milliseconds.
+    /// FAILURE : Does not fail.
+    ///
+    REAI_API u64 PollerBackoff (const PollerOptions* options, u32 attempt, u64 seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_API_POLLER_H
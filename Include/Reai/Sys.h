@@ -7,8 +7,12 @@
 #    define SYS_ERROR_STR_MAX_LENGTH 128
 #endif
 
-typedef unsigned long   SysProcessId;
-typedef struct SysMutex SysMutex;
+typedef unsigned long    SysProcessId;
+typedef struct SysMutex  SysMutex;
+typedef struct SysCond   SysCond;
+typedef struct SysThread SysThread;
+
+typedef void (*SysThreadFn) (void *arg);
 
 REAI_API Str *SysGetLocalTime (Str *timebuf);
 
@@ -76,6 +80,102 @@ REAI_API SysMutex *SysMutexLock (SysMutex *m);
 ///
 REAI_API SysMutex *SysMutexUnlock (SysMutex *m);
 
+///
+/// Atomically replace value at `dst` with `desired` if it currently holds `expected`.
+/// Useful for lazily creating objects that might be shared between threads.
+///
+/// dst[in,out]  : Pointer to the pointer to be swapped.
+/// expected[in] : Value `*dst` is expected to hold.
+/// desired[in]  : Value to store in `*dst`.
+///
+/// RETURN : Value held by `*dst` before the operation. Swap took place if it equals `expected`.
+///
+REAI_API void *SysAtomicCasPtr (void *volatile *dst, void *expected, void *desired);
+
+///
+/// Create a platform-independent condition variable, to be used together with a `SysMutex`.
+///
+/// SUCCESS : A valid SysCond object
+/// FAILURE : `NULL`
+///
+REAI_API SysCond *SysCondCreate();
+
+///
+/// Destroy the provided condition variable. Using it after this call is UB.
+///
+/// c[in] : Condition variable to be destroyed.
+///
+REAI_API void SysCondDestroy (SysCond *c);
+
+///
+/// Atomically release `m` and wait on `c` until signalled, then reacquire `m`.
+/// Like any condition variable, wakeups may be spurious, so always wait in a loop.
+///
+/// c[in,out] : Condition variable to wait on.
+/// m[in,out] : Mutex locked by caller.
+///
+/// SUCCESS : `c`
+/// FAILURE : `NULL`
+///
+REAI_API SysCond *SysCondWait (SysCond *c, SysMutex *m);
+
+///
+/// Same as `SysCondWait`, but gives up after given timeout.
+///
+/// c[in,out]      : Condition variable to wait on.
+/// m[in,out]      : Mutex locked by caller.
+/// timeout_ms[in] : Max time to wait in milliseconds.
+///
+/// SUCCESS : true if signalled (or spuriously woken up) before timeout.
+/// FAILURE : false on timeout or error.
+///
+REAI_API bool SysCondWaitTimeout (SysCond *c, SysMutex *m, u64 timeout_ms);
+
+///
+/// Wake up one thread waiting on `c`.
+///
+/// c[in,out] : Condition variable to signal.
+///
+REAI_API void SysCondSignal (SysCond *c);
+
+///
+/// Wake up all threads waiting on `c`.
+///
+/// c[in,out] : Condition variable to broadcast.
+///
+REAI_API void SysCondBroadcast (SysCond *c);
+
+///
+/// Create and start a new thread executing `fn (arg)`.
+///
+/// fn[in]  : Thread entry point.
+/// arg[in] : Argument passed to `fn`.
+///
+/// SUCCESS : A valid SysThread object. Must be joined using `SysThreadJoin`.
+/// FAILURE : `NULL`
+///
+REAI_API SysThread *SysThreadCreate (SysThreadFn fn, void *arg);
+
+///
+/// Wait for given thread to exit and free resources held by it.
+///
+/// t[in] : Thread to be joined.
+///
+REAI_API void SysThreadJoin (SysThread *t);
+
+///
+/// Get a monotonic timestamp in milliseconds. Only differences between two
+/// values returned by this function are meaningful.
+///
+REAI_API u64 SysGetMonotonicTimeMs();
+
+///
+/// Suspend calling thread for at least given number of milliseconds.
+///
+/// ms[in] : Time to sleep for.
+///
+REAI_API void SysSleepMs (u64 ms);
+
 ///
 /// Get last error using an error number.
 ///
@@ -137,6 +137,19 @@ typedef struct Number {
     };
 } Number;
 
+///
+/// A JSON string value, looked at right where it is in the input instead of being copied out.
+/// `data` is not NUL terminated, and is only valid for as long as the input is.
+///
+/// TAGS: JSON, String, View, ZeroCopy
+typedef struct JStrView {
+    const char* data;    /**< @b First character after opening quote. */
+    size        length;  /**< @b Length in input, escape sequences included. */
+    bool        escaped; /**< @b Has escape sequences, so `data` differs from actual value. */
+} JStrView;
+
+#define JStrViewInit() ((JStrView) {.data = NULL, .length = 0, .escaped = false})
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -155,12 +168,11 @@ extern "C" {
 
     ///
     /// Read a quoted string, handling escape sequences.
+    /// Unescaped value is appended to `str`, allocating at most once.
     ///
     /// si[in]   : Current reading position in input string
     /// str[out] : Output string to store parsed result
     ///
-    /// NOTE: Unicode escape sequences like `\uXXXX` are not supported.
-    ///
     /// SUCCESS : Returns `StrIter` advanced past closing quote
     /// FAILURE : Returns original `StrIter` on error (invalid escape, missing quote, etc.)
     ///
@@ -169,7 +181,46 @@ extern "C" {
     REAI_API StrIter JReadString (StrIter si, Str* str);
 
     ///
-    /// Read a JSON number (int or float) from input string.
+    /// Read a quoted string without copying or unescaping it. Escape sequences are only
+    /// validated, and can be resolved later (if at all) using `JStrViewUnescape`.
+    ///
+    /// si[in]    : Current reading position in input string
+    /// view[out] : Where string is, in input string
+    ///
+    /// SUCCESS : Returns `StrIter` advanced past closing quote
+    /// FAILURE : Returns original `StrIter` on error (invalid escape, missing quote, etc.)
+    ///
+    /// TAGS: JSON, String, Parsing, View, ZeroCopy
+    ///
+    REAI_API StrIter JReadStringView (StrIter si, JStrView* view);
+
+    ///
+    /// Append actual value of a string view to `str`, resolving escape sequences.
+    /// `\uXXXX` sequences (surrogate pairs included) are converted to UTF-8.
+    ///
+    /// view[in] : View read using `JReadStringView`.
+    /// str[out] : String to append to.
+    ///
+    /// SUCCESS : true
+    /// FAILURE : false on invalid arguments
+    ///
+    /// TAGS: JSON, String, EscapeSequences, Unicode
+    ///
+    REAI_API bool JStrViewUnescape (const JStrView* view, Str* str);
+
+    ///
+    /// Compare actual value of a string view with a NUL terminated string, without unescaping it.
+    ///
+    /// SUCCESS : true if both are same.
+    /// FAILURE : false otherwise.
+    ///
+    /// TAGS: JSON, String, View, Compare
+    ///
+    REAI_API bool JStrViewEqZstr (const JStrView* view, const char* zstr);
+
+    ///
+    /// Read a JSON number (int or float) from input string, in place without allocating.
+    /// Integers outside `i64` range are clamped to it.
     ///
     /// si[in]   : Current reading position in input string
     /// num[out] : Output number object to hold parsed result
@@ -183,6 +234,7 @@ extern "C" {
 
     ///
     /// Strictly read an integer from input string.
+    /// A string holding nothing but an integer (e.g. "42") is read as one too.
     ///
     /// si[in]   : Current reading position in input string
     /// val[out] : Pointer to i64 to store parsed integer
@@ -195,7 +247,8 @@ extern "C" {
     REAI_API StrIter JReadInteger (StrIter si, i64* val);
 
     ///
-    /// Read a floating-point number from input string.
+    /// Read a floating-point number from input string, correctly rounded to nearest.
+    /// A string holding nothing but a number (e.g. "0.5") is read as one too.
     ///
     /// si[in]   : Current reading position in input string
     /// val[out] : Pointer to f64 to store parsed value
@@ -233,6 +286,8 @@ extern "C" {
 
     ///
     /// Skip the current JSON value at reading position.
+    /// Objects and arrays are skipped by matching brackets and strings only, without
+    /// validating separators and scalar values inside them.
     ///
     /// si[in] : Current position in string iterator to skip value from
     ///
@@ -243,10 +298,47 @@ extern "C" {
     ///
     REAI_API StrIter JSkipValue (StrIter si);
 
+    ///
+    /// Name of kernels used to scan JSON input on this machine.
+    ///
+    /// SUCCESS : "avx2", "sse2" or "scalar".
+    /// FAILURE : Does not fail.
+    ///
+    /// TAGS: JSON, Utility
+    ///
+    REAI_API const char* JScanKernelName();
+
 #ifdef __cplusplus
 }
 #endif
 
+///
+/// Hash of an object key, made of its length and its first, middle and last characters.
+/// Like the positions a perfect hash generator would pick, these tell apart keys of an
+/// object nearly always, so a single compare rules out every field but the right one.
+///
+/// s[in] : Characters of key, need not be NUL terminated.
+/// n[in] : Length of key.
+///
+/// TAGS: JSON, Macro, Reader, Hash
+///
+#define JR_KEY_HASH(s, n)                                                                          \
+    ((n) ? ((u32)(u8)(n) | ((u32)(u8)(s)[0] << 8) | ((u32)(u8)(s)[(n) / 2] << 16) |                \
+            ((u32)(u8)(s)[(n) - 1] << 24))                                                         \
+         : 0u)
+
+///
+/// Check whether key read by enclosing `JR_OBJ` is `k`. Hash of `k` is folded into a
+/// constant by compiler, so a key is compared in full only with field its hash matches.
+///
+/// k[in] : Expected key name. Must be a string literal.
+///
+/// TAGS: JSON, Macro, Reader, KeyValue
+///
+#define JR_KEY_IS(k)                                                                               \
+    (key_hash == JR_KEY_HASH ((k), sizeof ("" k) - 1) && key.length == sizeof ("" k) - 1 &&        \
+     !memcmp (key.data, (k), sizeof ("" k) - 1))
+
 ///
 /// Read a JSON string value from stream and assign to target.
 /// The resulting string is dynamically allocated in `Str` format.
@@ -273,7 +365,7 @@ extern "C" {
 /// Read a string key-value pair if key matches.
 ///
 /// si[in,out] : JSON stream iterator to read from.
-/// k[in]      : Expected key name (C-string).
+/// k[in]      : Expected key name (string literal).
 /// str[out]   : Destination `Str` to store the value.
 ///
 /// USAGE:
@@ -286,13 +378,57 @@ extern "C" {
 ///
 #define JR_STR_KV(si, k, str)                                                                      \
     do {                                                                                           \
-        if (!StrCmpZstr (&key, (k))) {                                                             \
+        if (JR_KEY_IS (k)) {                                                                       \
             Str my_str = StrInit();                                                                \
             si         = JReadString ((si), &my_str);                                              \
             (str)      = my_str;                                                                   \
         }                                                                                          \
     } while (0)
 
+///
+/// Read a JSON string value without copying it out of input.
+///
+/// si[in,out] : JSON stream iterator to read from.
+/// view[out]  : `JStrView` pointing into input. Valid only for as long as input is.
+///
+/// USAGE:
+///   JStrView asm_line;
+///   JR_STR_VIEW(si, asm_line);
+///
+/// SUCCESS : `view` points to string in input.
+/// FAILURE : `si` remains unchanged, `view` is reset.
+///
+/// TAGS: JSON, Macro, Reader, String, View, ZeroCopy
+///
+#define JR_STR_VIEW(si, view)                                                                      \
+    do {                                                                                           \
+        JStrView my_view = JStrViewInit();                                                         \
+        si               = JReadStringView ((si), &my_view);                                       \
+        (view)           = my_view;                                                                \
+    } while (0)
+
+///
+/// Read a JSON string value without copying it out of input, if key matches.
+///
+/// si[in,out] : JSON stream iterator to read from.
+/// k[in]      : Expected key name (string literal).
+/// view[out]  : `JStrView` pointing into input. Valid only for as long as input is.
+///
+/// USAGE:
+///   JR_STR_VIEW_KV(si, "decompilation", code);
+///
+/// SUCCESS : `view` points to value if key matched
+/// FAILURE : No-op if key does not match
+///
+/// TAGS: JSON, Macro, Reader, String, View, KeyValue
+///
+#define JR_STR_VIEW_KV(si, k, view)                                                                \
+    do {                                                                                           \
+        if (JR_KEY_IS (k)) {                                                                       \
+            JR_STR_VIEW (si, view);                                                                \
+        }                                                                                          \
+    } while (0)
+
 ///
 /// Read a JSON integer value from stream and assign to target.
 ///
@@ -318,7 +454,7 @@ extern "C" {
 /// Read an integer key-value pair if key matches.
 ///
 /// si[in,out] : JSON stream iterator to read from.
-/// k[in]      : Expected key name (C-string).
+/// k[in]      : Expected key name (string literal).
 /// i[out]     : Integer variable to store the value.
 ///
 /// USAGE:
@@ -331,7 +467,7 @@ extern "C" {
 ///
 #define JR_INT_KV(si, k, i)                                                                        \
     do {                                                                                           \
-        if (!StrCmpZstr (&key, (k))) {                                                             \
+        if (JR_KEY_IS (k)) {                                                                       \
             i64 my_int = 0;                                                                        \
             si         = JReadInteger ((si), &my_int);                                             \
             (i)        = my_int;                                                                   \
@@ -363,7 +499,7 @@ extern "C" {
 /// Read a float key-value pair if key matches.
 ///
 /// si[in,out] : JSON stream iterator to read from.
-/// k[in]      : Expected key name (C-string).
+/// k[in]      : Expected key name (string literal).
 /// f[out]     : Float variable to store the value.
 ///
 /// USAGE:
@@ -376,7 +512,7 @@ extern "C" {
 ///
 #define JR_FLT_KV(si, k, f)                                                                        \
     do {                                                                                           \
-        if (!StrCmpZstr (&key, (k))) {                                                             \
+        if (JR_KEY_IS (k)) {                                                                       \
             f64 my_flt = 0;                                                                        \
             si         = JReadFloat ((si), &my_flt);                                               \
             (f)        = my_flt;                                                                   \
@@ -408,7 +544,7 @@ extern "C" {
 /// Read a boolean key-value pair if key matches.
 ///
 /// si[in,out] : JSON stream iterator to read from.
-/// k[in]      : Expected key name (C-string).
+/// k[in]      : Expected key name (string literal).
 /// b[out]     : Boolean variable to store the value.
 ///
 /// USAGE:
@@ -421,7 +557,7 @@ extern "C" {
 ///
 #define JR_BOOL_KV(si, k, b)                                                                       \
     do {                                                                                           \
-        if (!StrCmpZstr (&key, (k))) {                                                             \
+        if (JR_KEY_IS (k)) {                                                                       \
             bool my_b = 0;                                                                         \
             si        = JReadBool ((si), &my_b);                                                   \
             (b)       = my_b;                                                                      \
@@ -498,7 +634,6 @@ extern "C" {
                 /* if still no advancement in read position */                                     \
                 if (read_si.pos == si.pos) {                                                       \
                     LOG_ERROR ("Failed to parse value. Invalid JSON.");                            \
-                    StrDeinit (&key);                                                              \
                     failed = true;                                                                 \
                     si     = saved_si;                                                             \
                     break;                                                                         \
@@ -530,6 +665,10 @@ extern "C" {
 /// The macro parses the object and invokes the provided code block for each key-value pair.
 /// If the key is not recognized or parsing fails, the value is skipped.
 ///
+/// Inside the block, current key is available as `Str key`. Unless it had escape sequences,
+/// it points right into the input and is not NUL terminated : `key.data` is not a C string,
+/// so always use it along with `key.length`, and copy it out if it must outlive the block.
+///
 /// si[in,out] : Stream iterator to read from.
 /// reader     : Code block to handle each key-value pair. Can include JR_*_KV macros.
 ///
@@ -582,25 +721,36 @@ extern "C" {
             }                                                                                      \
                                                                                                    \
                                                                                                    \
-            Str key = StrInit();                                                                   \
-                                                                                                   \
-            /* key start */                                                                        \
-            read_si = JReadString (si, &key);                                                      \
+            /* key start, left in input unless it has escape sequences */                          \
+            JStrView key_view = JStrViewInit();                                                    \
+            read_si           = JReadStringView (si, &key_view);                                   \
             if (read_si.pos == si.pos) {                                                           \
                 LOG_ERROR ("Failed to read string key in object. Invalid JSON");                   \
-                StrDeinit (&key);                                                                  \
                 failed = true;                                                                     \
                 si     = saved_si;                                                                 \
                 break;                                                                             \
             }                                                                                      \
                                                                                                    \
+            Str key = StrInit();                                                                   \
+            if (key_view.escaped) {                                                                \
+                JStrViewUnescape (&key_view, &key);                                                \
+            } else {                                                                               \
+                key.data   = (char*)key_view.data;                                                 \
+                key.length = key_view.length;                                                      \
+            }                                                                                      \
+                                                                                                   \
+            u32 key_hash = JR_KEY_HASH (key.data, key.length);                                     \
+            (void)key_hash;                                                                        \
+                                                                                                   \
             si = read_si;                                                                          \
             si = JSkipWhitespace (si);                                                             \
                                                                                                    \
                                                                                                    \
             if (StrIterPeek (&si) != ':') {                                                        \
                 LOG_ERROR ("Expected ':' after key string. Failed to read JSON");                  \
-                StrDeinit (&key);                                                                  \
+                if (key_view.escaped) {                                                            \
+                    StrDeinit (&key);                                                              \
+                }                                                                                  \
                 failed = true;                                                                     \
                 si     = saved_si;                                                                 \
                 break;                                                                             \
@@ -622,16 +772,24 @@ extern "C" {
                 /* if still no advancement in read position */                                     \
                 if (read_si.pos == si.pos) {                                                       \
                     LOG_ERROR ("Failed to parse value. Invalid JSON.");                            \
-                    StrDeinit (&key);                                                              \
+                    if (key_view.escaped) {                                                        \
+                        StrDeinit (&key);                                                          \
+                    }                                                                              \
                     failed = true;                                                                 \
                     si     = saved_si;                                                             \
                     break;                                                                         \
                 }                                                                                  \
                                                                                                    \
-                LOG_INFO ("User skipped reading of '%s' field in JSON object.", key.data);         \
+                LOG_INFO (                                                                         \
+                    "User skipped reading of '%.*s' field in JSON object.",                        \
+                    (i32)key.length,                                                               \
+                    key.data                                                                       \
+                );                                                                                 \
                 si = read_si;                                                                      \
             }                                                                                      \
-            StrDeinit (&key);                                                                      \
+            if (key_view.escaped) {                                                                \
+                StrDeinit (&key);                                                                  \
+            }                                                                                      \
             si = JSkipWhitespace (si);                                                             \
                                                                                                    \
                                                                                                    \
@@ -655,7 +813,7 @@ extern "C" {
 /// Conditionally parse a JSON object if key matches expected name.
 ///
 /// si[in,out] : Stream iterator to read from.
-/// k[in]      : Expected key name (C-string).
+/// k[in]      : Expected key name (string literal).
 /// reader     : Code block to handle key-value pairs in object.
 ///
 /// USAGE:
@@ -670,7 +828,7 @@ extern "C" {
 ///
 #define JR_OBJ_KV(si, k, reader)                                                                   \
     do {                                                                                           \
-        if (!StrCmpZstr (&key, (k))) {                                                             \
+        if (JR_KEY_IS (k)) {                                                                       \
             JR_OBJ (si, reader);                                                                   \
         }                                                                                          \
     } while (0)
@@ -679,7 +837,7 @@ extern "C" {
 /// Conditionally parse a JSON array if key matches expected name.
 ///
 /// si[in,out] : Stream iterator to read from.
-/// k[in]      : Expected key name (C-string).
+/// k[in]      : Expected key name (string literal).
 /// reader     : Code block to handle array element parsing.
 ///
 /// USAGE:
@@ -695,7 +853,7 @@ extern "C" {
 ///
 #define JR_ARR_KV(si, k, reader)                                                                   \
     do {                                                                                           \
-        if (!StrCmpZstr (&key, (k))) {                                                             \
+        if (JR_KEY_IS (k)) {                                                                       \
             JR_ARR (si, reader);                                                                   \
         }                                                                                          \
     } while (0)
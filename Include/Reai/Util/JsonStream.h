@@ -0,0 +1,105 @@
+/**
+ * @file JsonStream.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Incremental splitter for large JSON responses of the form
+ *    `{ ..., "key" : [ elem, elem, ... ], ... }`.
+ *    Chunks are fed as they arrive from the network. Each element of the array
+ *    under `key` is handed to a reader as soon as it is complete, and then dropped.
+ *    Everything else (the envelope) is kept, with the streamed array left empty,
+ *    so it can still be read with the usual `JR_OBJ` readers once transfer completes.
+ *    The full body is never held in memory at once.
+ * */
+
+#ifndef REAI_UTIL_JSON_STREAM_H
+#define REAI_UTIL_JSON_STREAM_H
+
+#include <Reai/Types.h>
+#include <Reai/Util/Json.h>
+#include <Reai/Util/Str.h>
+
+///
+/// Reads one complete element of a streamed array.
+///
+/// si[in]  : Iterator over complete JSON text of a single element.
+/// ctx[in] : Context given when stream was created.
+///
+/// RETURN : true to continue, false to abort the stream.
+///
+typedef bool (*JsonElementReader) (StrIter si, void* ctx);
+
+typedef struct JsonStream {
+    const char*       array_key; /**< @b Key of top-level array whose elements are streamed. */
+    JsonElementReader reader;
+    void*             ctx;
+
+    Str envelope; /**< @b Everything except streamed elements. */
+    Str element;  /**< @b Element being accumulated. Reused for all elements. */
+
+    u32  depth;     /**< @b Nesting depth at current position. */
+    size key_start; /**< @b Offset of last top-level string in `envelope`. */
+    size key_end;   /**< @b Offset just past last top-level string in `envelope`. */
+    bool in_string;
+    bool escaped;
+    bool streaming; /**< @b Currently inside streamed array. */
+    bool streamed;  /**< @b Streamed array has been seen and closed. */
+    bool failed;
+    u64  elements; /**< @b Number of elements handed to reader so far. */
+} JsonStream;
+
+#define JsonStreamInit(key, rdr, c)                                                                \
+    {.array_key = (key),                                                                           \
+     .reader    = (rdr),                                                                           \
+     .ctx       = (c),                                                                             \
+     .envelope  = StrInit(),                                                                       \
+     .element   = StrInit()}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Deinit given stream, freeing buffers held by it.
+    ///
+    /// js[in,out] : Stream to be deinited.
+    ///
+    /// TAGS: JSON, Streaming
+    ///
+    REAI_API void JsonStreamDeinit (JsonStream* js);
+
+    ///
+    /// Feed next chunk of JSON text into the stream. Reader is invoked for every
+    /// element that completes inside this chunk.
+    ///
+    /// js[in,out] : Stream to feed.
+    /// data[in]   : Chunk data. Need not end at any token boundary.
+    /// length[in] : Chunk length in bytes.
+    ///
+    /// SUCCESS : true
+    /// FAILURE : false if reader aborted the stream or stream already failed.
+    ///
+    /// TAGS: JSON, Streaming
+    ///
+    REAI_API bool JsonStreamFeed (JsonStream* js, const char* data, size length);
+
+    ///
+    /// Complete the stream after last chunk has been fed, and append envelope
+    /// (with streamed array left empty) to given string.
+    ///
+    /// js[in,out]    : Stream to complete.
+    /// envelope[out] : Where remaining JSON text is appended.
+    ///
+    /// SUCCESS : true if JSON text was complete.
+    /// FAILURE : false if stream failed, or input ended in the middle of a value.
+    ///
+    /// TAGS: JSON, Streaming
+    ///
+    REAI_API bool JsonStreamFinish (JsonStream* js, Str* envelope);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_UTIL_JSON_STREAM_H
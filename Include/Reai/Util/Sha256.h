@@ -0,0 +1,85 @@
+/**
+ * @file Sha256.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Streaming SHA-256 (FIPS 180-4). Data can be fed in pieces of any size,
+ *    and files are hashed through a memory map, a window at a time, so that
+ *    large binaries never have to be read into memory as a whole.
+ * */
+
+#ifndef REAI_UTIL_SHA256_H
+#define REAI_UTIL_SHA256_H
+
+#include <Reai/Types.h>
+#include <Reai/Util/Str.h>
+
+/// Length of digest in bytes, and of its hex representation in characters.
+#define SHA256_DIGEST_SIZE     32
+#define SHA256_HEX_DIGEST_SIZE 64
+
+typedef struct Sha256 {
+    u32  state[8];
+    u64  length;      /**< @b Total bytes hashed so far. */
+    u8   block[64];   /**< @b Partial block waiting for more data. */
+    size block_fill; /**< @b Bytes used in `block`. */
+} Sha256;
+
+#define Sha256Init()                                                                               \
+    {.state = {0x6a09e667,                                                                         \
+               0xbb67ae85,                                                                         \
+               0x3c6ef372,                                                                         \
+               0xa54ff53a,                                                                         \
+               0x510e527f,                                                                         \
+               0x9b05688c,                                                                         \
+               0x1f83d9ab,                                                                         \
+               0x5be0cd19}}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Feed more data into hash.
+    ///
+    /// ctx[in,out] : Hash context created with `Sha256Init()`.
+    /// data[in]    : Data to hash.
+    /// length[in]  : Length of data in bytes.
+    ///
+    /// TAGS: Hash, SHA256
+    ///
+    REAI_API void Sha256Update (Sha256* ctx, const void* data, size length);
+
+    ///
+    /// Complete hash and append lowercase hex digest to given string.
+    /// Context must be re-inited with `Sha256Init()` before it's used again.
+    ///
+    /// ctx[in,out] : Hash context.
+    /// hex[out]    : Where 64 hex characters are appended.
+    ///
+    /// SUCCESS : `hex`
+    /// FAILURE : NULL
+    ///
+    /// TAGS: Hash, SHA256
+    ///
+    REAI_API Str* Sha256Final (Sha256* ctx, Str* hex);
+
+    ///
+    /// Hash complete contents of a file, mapping it into memory a window at a time.
+    ///
+    /// path[in] : Path of file to hash.
+    /// hex[out] : Where 64 hex characters of digest are appended.
+    ///
+    /// SUCCESS : `hex`
+    /// FAILURE : NULL, and `hex` is left unchanged.
+    ///
+    /// TAGS: Hash, SHA256, File
+    ///
+    REAI_API Str* Sha256File (const char* path, Str* hex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_UTIL_SHA256_H
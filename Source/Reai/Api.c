@@ -7,33 +7,117 @@
 
 #include <Reai/Api.h>
 #include <Reai/Log.h>
+#include <Reai/Sys.h>
 #include <Reai/Util/Json.h>
+#include <Reai/Util/Sha256.h>
+
+// libc
+#include <ctype.h>
+
+///
+/// Every endpoint is split into a request builder and a response parser,
+/// so that blocking and asynchronous variants share exactly the same code.
+///
+/// Builders return false (after logging) if request cannot be made with given arguments.
+/// Parsers always initialize the output object, and return false if response
+/// indicates failure.
+///
+
+static bool Perform (
+    Connection*       conn,
+    bool              built,
+    ApiRequest*       req,
+    ApiResponseParser parser,
+    void*             out
+) {
+    bool res = built && ConnectionPerform (conn, req, parser, out);
+    ConnectionReleaseRequest (conn, req);
+    return res;
+}
 
-bool Authenticate (Connection* conn) {
-    if (!conn->api_key.length || !conn->host.length) {
+///
+/// Queue given request on the async engine. Output object is zeroed first, so that a future
+/// that fails before its parser runs leaves it just as the blocking variant would return it.
+///
+/// out_size[in] : Size of output object. 0 if it must be left as is.
+///
+static ApiFuture* Submit (
+    Connection*       conn,
+    bool              built,
+    ApiRequest*       req,
+    ApiResponseParser parser,
+    void*             out,
+    size              out_size,
+    ApiCallback       callback,
+    void*             user_data
+) {
+    if (out && out_size) {
+        memset (out, 0, out_size);
+    }
+
+    if (!built) {
+        ConnectionReleaseRequest (conn, req);
+        return NULL;
+    }
+    return ConnectionSubmit (conn, req, parser, out, callback, user_data);
+}
+
+static bool CheckConnection (Connection* conn) {
+    if (!conn || !conn->api_key.length || !conn->host.length) {
         LOG_ERROR ("Missing API key or host to connect to.");
         return false;
     }
+    return true;
+}
 
-    Str url = StrInit();
-    StrPrintf (&url, "%s/v1/authenticate", conn->host.data);
+///
+/// Parse responses of the form `{"status": bool, ...}`
+///
+static bool ParseStatusFlag (Str* json, void* out) {
+    bool* status = (bool*)out;
+    *status      = false;
 
-    bool res = MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, NULL, "GET");
+    StrIter j = StrIterInitFromStr (json);
+    JR_OBJ (j, { JR_BOOL_KV (j, "status", *status); });
 
-    StrDeinit (&url);
+    return *status;
+}
 
-    return res;
+static bool BuildAuthenticate (Connection* conn, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
+    }
+
+    StrPrintf (&req->url, "%s/v1/authenticate", conn->host.data);
+    req->method = "GET";
+
+    return true;
 }
 
-BinaryId CreateNewAnalysis (Connection* conn, NewAnalysisRequest* request) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return 0;
+bool Authenticate (Connection* conn) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    if (!Perform (conn, BuildAuthenticate (conn, &req), &req, NULL, NULL)) {
+        return false;
+    }
+
+    // a connection that failed to open now will just be opened by the call needing it
+    ConnectionWarmup (conn, conn->warmup_connections);
+    return true;
+}
+
+ApiFuture* AuthenticateAsync (Connection* conn, ApiCallback callback, void* user_data) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (conn, BuildAuthenticate (conn, &req), &req, NULL, NULL, 0, callback, user_data);
+}
+
+static bool BuildCreateNewAnalysis (Connection* conn, NewAnalysisRequest* request, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!request) {
         LOG_ERROR ("Invalid request");
-        return 0;
+        return false;
     }
 
     if (request->file_opt >= FILE_OPTION_MAX) {
@@ -41,10 +125,8 @@ BinaryId CreateNewAnalysis (Connection* conn, NewAnalysisRequest* request) {
         request->file_opt = FILE_OPTION_AUTO;
     }
 
-    Str url = StrInit();
-    Str sj  = StrInit(); // send json
-
-    StrPrintf (&url, "%s/v1/analyse/", conn->host.data);
+    StrPrintf (&req->url, "%s/v1/analyse/", conn->host.data);
+    req->method = "POST";
 
     static const char* file_opt_to_str[] = {
         [FILE_OPTION_AUTO]  = "Auto",
@@ -56,6 +138,8 @@ BinaryId CreateNewAnalysis (Connection* conn, NewAnalysisRequest* request) {
         [FILE_OPTION_DLL]   = "DLL",
     };
 
+    Str sj = req->body; // send json, written into pooled buffer
+
     JW_OBJ (sj, {
         JW_STR_KV (sj, "model_name", request->ai_model);
         if (request->platform_opt.length) {
@@ -103,84 +187,167 @@ BinaryId CreateNewAnalysis (Connection* conn, NewAnalysisRequest* request) {
         JW_BOOL_KV (sj, "advanced_analysis", request->advanced_analysis);
     });
 
-    Str gj = StrInit(); // get json
+    req->body = sj;
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, &sj, &gj, "POST")) {
-        StrDeinit (&url);
-        StrDeinit (&sj);
+    return true;
+}
 
-        StrIter j = StrIterInitFromStr (&gj);
+static bool ParseCreateNewAnalysis (Str* json, void* out) {
+    BinaryId* binary_id = (BinaryId*)out;
+    *binary_id          = 0;
 
-        bool     success   = false;
-        BinaryId binary_id = 0;
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "success", success);
-            if (success) {
-                JR_INT_KV (j, "binary_id", binary_id);
-            }
-        });
+    StrIter j = StrIterInitFromStr (json);
 
-        StrDeinit (&gj);
+    bool success = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "success", success);
+        if (success) {
+            JR_INT_KV (j, "binary_id", *binary_id);
+        }
+    });
 
-        return binary_id;
-    } else {
-        return 0;
-    }
+    return success;
 }
 
-FunctionInfos GetBasicFunctionInfoUsingBinaryId (Connection* conn, BinaryId binary_id) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (FunctionInfos) {0};
+BinaryId CreateNewAnalysis (Connection* conn, NewAnalysisRequest* request) {
+    ApiRequest req       = ConnectionAcquireRequest (conn);
+    BinaryId   binary_id = 0;
+    Perform (
+        conn,
+        BuildCreateNewAnalysis (conn, request, &req),
+        &req,
+        ParseCreateNewAnalysis,
+        &binary_id
+    );
+    return binary_id;
+}
+
+ApiFuture* CreateNewAnalysisAsync (
+    Connection*         conn,
+    NewAnalysisRequest* request,
+    BinaryId*           binary_id,
+    ApiCallback         callback,
+    void*               user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildCreateNewAnalysis (conn, request, &req),
+        &req,
+        ParseCreateNewAnalysis,
+        binary_id,
+        sizeof (*binary_id),
+        callback,
+        user_data
+    );
+}
+
+static bool ReadFunctionInfo (StrIter j, void* out) {
+    FunctionInfo function   = {0};
+    function.symbol.is_addr = true;
+    JR_OBJ (j, {
+        JR_INT_KV (j, "function_id", function.id);
+        JR_STR_KV (j, "function_name", function.symbol.name);
+        JR_INT_KV (j, "function_size", function.size);
+        JR_INT_KV (j, "function_vaddr", function.symbol.value.addr);
+    });
+    VecPushBack ((FunctionInfos*)out, function);
+    return true;
+}
+
+///
+/// Function list can run into megabytes, so it's read while it downloads,
+/// directly into `functions`, which is initialized here.
+///
+static bool BuildGetBasicFunctionInfo (
+    Connection*    conn,
+    BinaryId       binary_id,
+    FunctionInfos* functions,
+    ApiRequest*    req
+) {
+    if (!functions) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    // initialized even if request can't be made, it's deinited either way
+    *functions = (FunctionInfos)VecInitWithDeepCopy (NULL, FunctionInfoDeinit);
+
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
+    StrPrintf (&req->url, "%s/v1/analyse/functions/%llu", conn->host.data, binary_id);
+    req->method = "GET";
 
-    StrPrintf (&url, "%s/v1/analyse/functions/%llu", conn->host.data, binary_id);
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
+    req->stream_key    = "functions";
+    req->stream_reader = ReadFunctionInfo;
+    req->stream_ctx    = functions;
 
-        StrIter j = StrIterInitFromStr (&gj);
+    return true;
+}
 
-        bool          success   = false;
-        FunctionInfos functions = VecInitWithDeepCopy (NULL, FunctionInfoDeinit);
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "success", success);
-            if (success) {
-                JR_ARR_KV (j, "functions", {
-                    FunctionInfo function   = {0};
-                    function.symbol.is_addr = true;
-                    JR_OBJ (j, {
-                        JR_INT_KV (j, "function_id", function.id);
-                        JR_STR_KV (j, "function_name", function.symbol.name);
-                        JR_INT_KV (j, "function_size", function.size);
-                        JR_INT_KV (j, "function_vaddr", function.symbol.value.addr);
-                    });
-                    VecPushBack (&functions, function);
-                });
-            }
-        });
+static bool ParseGetBasicFunctionInfo (Str* json, void* out) {
+    StrIter        j         = StrIterInitFromStr (json);
+    FunctionInfos* functions = (FunctionInfos*)out;
+
+    // functions have been streamed into `out` already
+    bool success = false;
+    JR_OBJ (j, { JR_BOOL_KV (j, "success", success); });
 
-        StrDeinit (&gj);
+    if (!success) {
+        VecDeinit (functions);
+    }
+    return success;
+}
 
-        return functions;
-    } else {
-        return (FunctionInfos) {0};
+FunctionInfos GetBasicFunctionInfoUsingBinaryId (Connection* conn, BinaryId binary_id) {
+    ApiRequest    req       = ConnectionAcquireRequest (conn);
+    FunctionInfos functions = {0};
+    if (!Perform (
+            conn,
+            BuildGetBasicFunctionInfo (conn, binary_id, &functions, &req),
+            &req,
+            ParseGetBasicFunctionInfo,
+            &functions
+        )) {
+        // free whatever arrived before transfer failed, a failed call returns a zeroed vector
+        VecDeinit (&functions);
     }
+    return functions;
+}
+
+ApiFuture* GetBasicFunctionInfoUsingBinaryIdAsync (
+    Connection*    conn,
+    BinaryId       binary_id,
+    FunctionInfos* functions,
+    ApiCallback    callback,
+    void*          user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetBasicFunctionInfo (conn, binary_id, functions, &req),
+        &req,
+        ParseGetBasicFunctionInfo,
+        functions,
+        0, // initialized by builder already, and filled while streaming
+        callback,
+        user_data
+    );
 }
 
 // TODO: GetBasicFunctionInfoUsingAnalysisId
 
-AnalysisInfos GetRecentAnalysis (Connection* conn, RecentAnalysisRequest* request) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (AnalysisInfos) {0};
+static bool
+    BuildGetRecentAnalysis (Connection* conn, RecentAnalysisRequest* request, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!request) {
         LOG_ERROR ("Invalid request");
-        return (AnalysisInfos) {0};
+        return false;
     }
 
     if (request->workspace >= WORKSPACE_MAX) {
@@ -193,166 +360,221 @@ AnalysisInfos GetRecentAnalysis (Connection* conn, RecentAnalysisRequest* reques
         request->order_by = ORDER_BY_CREATED;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
-
-    StrPrintf (&url, "%s/v2/analyses/list", conn->host.data);
+    Str* url = &req->url;
+    StrPrintf (url, "%s/v2/analyses/list", conn->host.data);
+    req->method = "GET";
 
     bool        is_first          = true;
-    const char* ws[WORKSPACE_MAX] = {"personal", "public", "team"};
+    const char* ws[WORKSPACE_MAX] = {
+        [WORKSPACE_PERSONAL] = "personal",
+        [WORKSPACE_TEAM]     = "team",
+        [WORKSPACE_PUBLIC]   = "public",
+    };
 
-    UrlAddQueryStr (&url, "search_term", request->search_term.data, &is_first);
-    UrlAddQueryStr (&url, "model_name", request->model_name.data, &is_first);
-    UrlAddQueryStr (&url, "workspace", ws[request->workspace], &is_first);
+    UrlAddQueryStr (url, "search_term", request->search_term.data, &is_first);
+    UrlAddQueryStr (url, "model_name", request->model_name.data, &is_first);
+    UrlAddQueryStr (url, "workspace", ws[request->workspace], &is_first);
     VecForeach (&request->usernames, username, {
-        UrlAddQueryStr (&url, "usernames", username.data, &is_first);
+        UrlAddQueryStr (url, "usernames", username.data, &is_first);
     });
-    UrlAddQueryInt (&url, "limit", CLAMP (request->limit, 5, 50), &is_first);
-    UrlAddQueryInt (&url, "offset", request->offset, &is_first);
-    UrlAddQueryStr (&url, "order", request->order_in_asc ? "ASC" : "DESC", &is_first);
+    UrlAddQueryInt (url, "limit", CLAMP (request->limit, 5, 50), &is_first);
+    UrlAddQueryInt (url, "offset", request->offset, &is_first);
+    UrlAddQueryStr (url, "order", request->order_in_asc ? "ASC" : "DESC", &is_first);
 
     switch (request->order_by) {
         case ORDER_BY_NAME :
-            UrlAddQueryStr (&url, "order_by", "name", &is_first);
+            UrlAddQueryStr (url, "order_by", "name", &is_first);
             break;
 
         case ORDER_BY_SIZE :
-            UrlAddQueryStr (&url, "order_by", "size", &is_first);
+            UrlAddQueryStr (url, "order_by", "size", &is_first);
             break;
 
         default :
-            UrlAddQueryStr (&url, "order_by", "created", &is_first);
+            UrlAddQueryStr (url, "order_by", "created", &is_first);
             break;
     }
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
-
-        StrIter j = StrIterInitFromStr (&gj);
+    return true;
+}
 
-        AnalysisInfos infos   = VecInitWithDeepCopy (NULL, AnalysisInfoDeinit);
-        bool          success = false;
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", success);
-            if (success) {
-                JR_OBJ_KV (j, "data", {
-                    JR_ARR_KV (j, "results", {
-                        AnalysisInfo info            = {0};
-                        Str          scope           = StrInit();
-                        Str          analysis_status = StrInit();
-                        Str          dyn_exec_status = StrInit();
-                        JR_OBJ (j, {
-                            JR_INT_KV (j, "analysis_id", info.analysis_id);
-                            JR_STR_KV (j, "analysis_scope", scope);
-                            JR_INT_KV (j, "binary_id", info.binary_id);
-                            JR_INT_KV (j, "model_id", info.model_id);
-                            JR_STR_KV (j, "status", analysis_status);
-                            JR_STR_KV (j, "creation", info.creation);
-                            JR_BOOL_KV (j, "is_owner", info.is_owner);
-                            JR_STR_KV (j, "binary_name", info.binary_name);
-                            JR_STR_KV (j, "sha_256_hash", info.sha256);
-                            JR_INT_KV (j, "binary_size", info.binary_size);
-                            JR_STR_KV (j, "username", info.username);
-                            JR_STR_KV (j, "dynamic_execution_status", dyn_exec_status);
-                            JR_INT_KV (j, "dynamic_execution_task_id", info.dyn_exec_task_id);
-                        });
-                        info.is_private      = !StrCmpZstr (&scope, "PRIVATE");
-                        info.status          = StatusFromStr (&analysis_status);
-                        info.dyn_exec_status = StatusFromStr (&dyn_exec_status);
-                        StrDeinit (&scope);
-                        StrDeinit (&analysis_status);
-                        StrDeinit (&dyn_exec_status);
-                        VecPushBack (&infos, info);
+static bool ParseGetRecentAnalysis (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    AnalysisInfos infos   = VecInitWithDeepCopy (NULL, AnalysisInfoDeinit);
+    bool          success = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", success);
+        if (success) {
+            JR_OBJ_KV (j, "data", {
+                JR_ARR_KV (j, "results", {
+                    AnalysisInfo info            = {0};
+                    Str          scope           = StrInit();
+                    Str          analysis_status = StrInit();
+                    Str          dyn_exec_status = StrInit();
+                    JR_OBJ (j, {
+                        JR_INT_KV (j, "analysis_id", info.analysis_id);
+                        JR_STR_KV (j, "analysis_scope", scope);
+                        JR_INT_KV (j, "binary_id", info.binary_id);
+                        JR_INT_KV (j, "model_id", info.model_id);
+                        JR_STR_KV (j, "status", analysis_status);
+                        JR_STR_KV (j, "creation", info.creation);
+                        JR_BOOL_KV (j, "is_owner", info.is_owner);
+                        JR_STR_KV (j, "binary_name", info.binary_name);
+                        JR_STR_KV (j, "sha_256_hash", info.sha256);
+                        JR_INT_KV (j, "binary_size", info.binary_size);
+                        JR_STR_KV (j, "username", info.username);
+                        JR_STR_KV (j, "dynamic_execution_status", dyn_exec_status);
+                        JR_INT_KV (j, "dynamic_execution_task_id", info.dyn_exec_task_id);
                     });
+                    info.is_private      = !StrCmpZstr (&scope, "PRIVATE");
+                    info.status          = StatusFromStr (&analysis_status);
+                    info.dyn_exec_status = StatusFromStr (&dyn_exec_status);
+                    StrDeinit (&scope);
+                    StrDeinit (&analysis_status);
+                    StrDeinit (&dyn_exec_status);
+                    VecPushBack (&infos, info);
                 });
-            }
-        });
+            });
+        }
+    });
 
-        StrDeinit (&gj);
+    *(AnalysisInfos*)out = infos;
+    return success;
+}
 
-        return infos;
-    } else {
-        return (AnalysisInfos) {0};
-    }
+AnalysisInfos GetRecentAnalysis (Connection* conn, RecentAnalysisRequest* request) {
+    ApiRequest    req   = ConnectionAcquireRequest (conn);
+    AnalysisInfos infos = {0};
+    Perform (
+        conn,
+        BuildGetRecentAnalysis (conn, request, &req),
+        &req,
+        ParseGetRecentAnalysis,
+        &infos
+    );
+    return infos;
 }
 
-BinaryInfos SearchBinary (Connection* conn, SearchBinaryRequest* request) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (BinaryInfos) {0};
+ApiFuture* GetRecentAnalysisAsync (
+    Connection*            conn,
+    RecentAnalysisRequest* request,
+    AnalysisInfos*         infos,
+    ApiCallback            callback,
+    void*                  user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetRecentAnalysis (conn, request, &req),
+        &req,
+        ParseGetRecentAnalysis,
+        infos,
+        sizeof (*infos),
+        callback,
+        user_data
+    );
+}
+
+static bool BuildSearchBinary (Connection* conn, SearchBinaryRequest* request, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!request) {
         LOG_ERROR ("Invalid request");
-        return (BinaryInfos) {0};
+        return false;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
-
-    StrPrintf (&url, "%s/v2/search/binaries", conn->host.data);
+    Str* url = &req->url;
+    StrPrintf (url, "%s/v2/search/binaries", conn->host.data);
+    req->method = "GET";
 
     bool is_first = true;
 
-    UrlAddQueryInt (&url, "page", request->page, &is_first);
-    UrlAddQueryInt (&url, "page_size", request->page_size, &is_first);
-    UrlAddQueryStr (&url, "partial_name", request->partial_name.data, &is_first);
-    UrlAddQueryStr (&url, "partial_sha256", request->partial_sha256.data, &is_first);
-    UrlAddQueryStr (&url, "model_name", request->model_name.data, &is_first);
-    VecForeach (&request->tags, tag, { UrlAddQueryStr (&url, "tags", tag.data, &is_first); });
-
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
-
-        StrIter j = StrIterInitFromStr (&gj);
-
-        bool        status = false;
-        BinaryInfos infos  = VecInitWithDeepCopy (NULL, BinaryInfoDeinit);
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_OBJ_KV (j, "data", {
-                    JR_ARR_KV (j, "results", {
-                        BinaryInfo info = {0};
-                        info.tags       = VecInitWithDeepCopy_T (&info.tags, NULL, StrDeinit);
-                        JR_OBJ (j, {
-                            JR_INT_KV (j, "binary_id", info.binary_id);
-                            JR_STR_KV (j, "binary_name", info.binary_name);
-                            JR_INT_KV (j, "analysis_id", info.analysis_id);
-                            JR_STR_KV (j, "sha_256_hash", info.sha256);
-                            JR_ARR_KV (j, "tags", {
-                                Str tag = StrInit();
-                                JR_STR (j, tag);
-                                VecPushBack (&info.tags, tag);
-                            });
-                            JR_STR_KV (j, "created_at", info.created_at);
-                            JR_INT_KV (j, "model_id", info.model_id);
-                            JR_STR_KV (j, "model_name", info.model_name);
-                            JR_STR_KV (j, "owned_by", info.owned_by);
+    UrlAddQueryInt (url, "page", request->page, &is_first);
+    UrlAddQueryInt (url, "page_size", request->page_size, &is_first);
+    UrlAddQueryStr (url, "partial_name", request->partial_name.data, &is_first);
+    UrlAddQueryStr (url, "partial_sha256", request->partial_sha256.data, &is_first);
+    UrlAddQueryStr (url, "model_name", request->model_name.data, &is_first);
+    VecForeach (&request->tags, tag, { UrlAddQueryStr (url, "tags", tag.data, &is_first); });
+
+    return true;
+}
+
+static bool ParseSearchBinary (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    bool        status = false;
+    BinaryInfos infos  = VecInitWithDeepCopy (NULL, BinaryInfoDeinit);
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_OBJ_KV (j, "data", {
+                JR_ARR_KV (j, "results", {
+                    BinaryInfo info = {0};
+                    info.tags       = VecInitWithDeepCopy_T (&info.tags, NULL, StrDeinit);
+                    JR_OBJ (j, {
+                        JR_INT_KV (j, "binary_id", info.binary_id);
+                        JR_STR_KV (j, "binary_name", info.binary_name);
+                        JR_INT_KV (j, "analysis_id", info.analysis_id);
+                        JR_STR_KV (j, "sha_256_hash", info.sha256);
+                        JR_ARR_KV (j, "tags", {
+                            Str tag = StrInit();
+                            JR_STR (j, tag);
+                            VecPushBack (&info.tags, tag);
                         });
-                        VecPushBack (&infos, info);
+                        JR_STR_KV (j, "created_at", info.created_at);
+                        JR_INT_KV (j, "model_id", info.model_id);
+                        JR_STR_KV (j, "model_name", info.model_name);
+                        JR_STR_KV (j, "owned_by", info.owned_by);
                     });
+                    VecPushBack (&infos, info);
                 });
-            }
-        });
+            });
+        }
+    });
 
-        StrDeinit (&gj);
+    *(BinaryInfos*)out = infos;
+    return status;
+}
 
-        return infos;
-    } else {
-        return (BinaryInfos) {0};
-    }
+BinaryInfos SearchBinary (Connection* conn, SearchBinaryRequest* request) {
+    ApiRequest  req   = ConnectionAcquireRequest (conn);
+    BinaryInfos infos = {0};
+    Perform (conn, BuildSearchBinary (conn, request, &req), &req, ParseSearchBinary, &infos);
+    return infos;
 }
 
-CollectionInfos SearchCollection (Connection* conn, SearchCollectionRequest* request) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (CollectionInfos) {0};
+ApiFuture* SearchBinaryAsync (
+    Connection*          conn,
+    SearchBinaryRequest* request,
+    BinaryInfos*         infos,
+    ApiCallback          callback,
+    void*                user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildSearchBinary (conn, request, &req),
+        &req,
+        ParseSearchBinary,
+        infos,
+        sizeof (*infos),
+        callback,
+        user_data
+    );
+}
+
+static bool
+    BuildSearchCollection (Connection* conn, SearchCollectionRequest* request, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!request) {
         LOG_ERROR ("Invalid request");
-        return (CollectionInfos) {0};
+        return false;
     }
 
     if (request->order_by >= ORDER_BY_MAX) {
@@ -369,31 +591,30 @@ CollectionInfos SearchCollection (Connection* conn, SearchCollectionRequest* req
         [ORDER_BY_LAST_UPDATED] = "updated"
     };
 
-    Str url = StrInit();
-    Str gj  = StrInit();
-
-    StrPrintf (&url, "%s/v2/search/collections", conn->host.data);
+    Str* url = &req->url;
+    StrPrintf (url, "%s/v2/search/collections", conn->host.data);
+    req->method = "GET";
 
     bool is_first = true;
 
 #define ADD_FILTER(f, v)                                                                           \
     if (request->f)                                                                                \
-    UrlAddQueryStr (&url, "filters", v, &is_first)
+    UrlAddQueryStr (url, "filters", v, &is_first)
 
-    UrlAddQueryInt (&url, "page", request->page, &is_first);
-    UrlAddQueryInt (&url, "page_size", request->page_size, &is_first);
+    UrlAddQueryInt (url, "page", request->page, &is_first);
+    UrlAddQueryInt (url, "page_size", request->page_size, &is_first);
     UrlAddQueryStr (
-        &url,
+        url,
         "partial_collection_name",
         request->partial_collection_name.data,
         &is_first
     );
-    UrlAddQueryStr (&url, "partial_binary_name", request->partial_binary_name.data, &is_first);
-    UrlAddQueryStr (&url, "partial_binary_sha256", request->partial_binary_sha256.data, &is_first);
-    VecForeach (&request->tags, tag, { UrlAddQueryStr (&url, "tags", tag.data, &is_first); });
-    UrlAddQueryStr (&url, "model_name", request->model_name.data, &is_first);
-    UrlAddQueryStr (&url, "order_by", order_by_to_str[request->order_by], &is_first);
-    UrlAddQueryStr (&url, "order_by_direction", request->order_in_asc ? "ASC" : "DESC", &is_first);
+    UrlAddQueryStr (url, "partial_binary_name", request->partial_binary_name.data, &is_first);
+    UrlAddQueryStr (url, "partial_binary_sha256", request->partial_binary_sha256.data, &is_first);
+    VecForeach (&request->tags, tag, { UrlAddQueryStr (url, "tags", tag.data, &is_first); });
+    UrlAddQueryStr (url, "model_name", request->model_name.data, &is_first);
+    UrlAddQueryStr (url, "order_by", order_by_to_str[request->order_by], &is_first);
+    UrlAddQueryStr (url, "order_by_direction", request->order_in_asc ? "ASC" : "DESC", &is_first);
     ADD_FILTER (filter_official, "official_only");
     ADD_FILTER (filter_user, "user_only");
     ADD_FILTER (filter_team, "team_only");
@@ -402,65 +623,94 @@ CollectionInfos SearchCollection (Connection* conn, SearchCollectionRequest* req
 
 #undef ADD_FILTER
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
-
-        StrIter j = StrIterInitFromStr (&gj);
-
-        bool            status = false;
-        CollectionInfos infos  = VecInitWithDeepCopy (NULL, CollectionInfoDeinit);
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_OBJ_KV (j, "data", {
-                    JR_ARR_KV (j, "results", {
-                        CollectionInfo info = {0};
-                        info.tags           = VecInitWithDeepCopy_T (&info.tags, NULL, StrDeinit);
-                        Str scope           = StrInit();
-                        JR_OBJ (j, {
-                            JR_INT_KV (j, "collection_id", info.id);
-                            JR_STR_KV (j, "collection_name", info.name);
-                            JR_STR_KV (j, "scope", scope);
-                            JR_STR_KV (j, "last_updated_at", info.last_updated_at);
-                            JR_STR_KV (j, "created_at", info.created_at);
-                            JR_INT_KV (j, "model_id", info.model_id);
-                            JR_STR_KV (j, "model_name", info.model_name);
-                            JR_STR_KV (j, "owned_by", info.owned_by);
-                            JR_ARR_KV (j, "tags", {
-                                Str tag = StrInit();
-                                JR_STR (j, tag);
-                                VecPushBack (&info.tags, tag);
-                            });
-                            JR_INT_KV (j, "size", info.size);
-                            JR_STR_KV (j, "description", info.description);
-                            JR_INT_KV (j, "team_id", info.team_id);
+    return true;
+}
+
+static bool ParseSearchCollection (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    bool            status = false;
+    CollectionInfos infos  = VecInitWithDeepCopy (NULL, CollectionInfoDeinit);
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_OBJ_KV (j, "data", {
+                JR_ARR_KV (j, "results", {
+                    CollectionInfo info = {0};
+                    info.tags           = VecInitWithDeepCopy_T (&info.tags, NULL, StrDeinit);
+                    Str scope           = StrInit();
+                    JR_OBJ (j, {
+                        JR_INT_KV (j, "collection_id", info.id);
+                        JR_STR_KV (j, "collection_name", info.name);
+                        JR_STR_KV (j, "scope", scope);
+                        JR_STR_KV (j, "last_updated_at", info.last_updated_at);
+                        JR_STR_KV (j, "created_at", info.created_at);
+                        JR_INT_KV (j, "model_id", info.model_id);
+                        JR_STR_KV (j, "model_name", info.model_name);
+                        JR_STR_KV (j, "owned_by", info.owned_by);
+                        JR_ARR_KV (j, "tags", {
+                            Str tag = StrInit();
+                            JR_STR (j, tag);
+                            VecPushBack (&info.tags, tag);
                         });
-                        info.is_private = !StrCmpZstr (&scope, "PRIVATE");
-                        StrDeinit (&scope);
-                        VecPushBack (&infos, info);
+                        JR_INT_KV (j, "size", info.size);
+                        JR_STR_KV (j, "description", info.description);
+                        JR_INT_KV (j, "team_id", info.team_id);
                     });
+                    info.is_private = !StrCmpZstr (&scope, "PRIVATE");
+                    StrDeinit (&scope);
+                    VecPushBack (&infos, info);
                 });
-            }
-        });
+            });
+        }
+    });
 
-        StrDeinit (&gj);
+    *(CollectionInfos*)out = infos;
+    return status;
+}
 
-        return infos;
-    } else {
-        return (CollectionInfos) {0};
-    }
+CollectionInfos SearchCollection (Connection* conn, SearchCollectionRequest* request) {
+    ApiRequest      req   = ConnectionAcquireRequest (conn);
+    CollectionInfos infos = {0};
+    Perform (
+        conn,
+        BuildSearchCollection (conn, request, &req),
+        &req,
+        ParseSearchCollection,
+        &infos
+    );
+    return infos;
 }
 
-bool BatchRenameFunctions (Connection* conn, FunctionInfos functions) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
+ApiFuture* SearchCollectionAsync (
+    Connection*              conn,
+    SearchCollectionRequest* request,
+    CollectionInfos*         infos,
+    ApiCallback              callback,
+    void*                    user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildSearchCollection (conn, request, &req),
+        &req,
+        ParseSearchCollection,
+        infos,
+        sizeof (*infos),
+        callback,
+        user_data
+    );
+}
+
+static bool BuildBatchRenameFunctions (Connection* conn, FunctionInfos functions, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
         return false;
     }
 
-    Str url = StrInit();
-    Str sj  = StrInit();
+    StrPrintf (&req->url, "%s/v2/functions/rename/batch", conn->host.data);
+    req->method = "POST";
 
-    StrPrintf (&url, "%s/v2/functions/rename/batch", conn->host.data);
+    Str sj = req->body; // written into pooled buffer
 
     JW_OBJ (sj, {
         JW_ARR_KV (sj, "functions", functions, function, {
@@ -471,28 +721,118 @@ bool BatchRenameFunctions (Connection* conn, FunctionInfos functions) {
         });
     });
 
-    Str gj = StrInit();
+    req->body = sj;
+
+    return true;
+}
+
+bool BatchRenameFunctions (Connection* conn, FunctionInfos functions) {
+    if (functions.length > BATCH_RENAME_DEFAULT_CHUNK_SIZE) {
+        return BatchRenameFunctionsChunked (conn, functions, 0, 0, NULL) == functions.length;
+    }
+
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    bool       status = false;
+    Perform (
+        conn,
+        BuildBatchRenameFunctions (conn, functions, &req),
+        &req,
+        ParseStatusFlag,
+        &status
+    );
+    return status;
+}
+
+size BatchRenameFunctionsChunked (
+    Connection*    conn,
+    FunctionInfos  functions,
+    size           chunk_size,
+    size           max_parallel,
+    RenameResults* results
+) {
+    if (results) {
+        *results = (RenameResults)VecInit();
+        VecResize (results, functions.length);
+        if (functions.length) {
+            memset (results->data, 0, functions.length * sizeof (bool));
+        }
+    }
+
+    if (!CheckConnection (conn)) {
+        return 0;
+    }
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, &sj, &gj, "POST")) {
-        StrDeinit (&url);
-        StrDeinit (&sj);
+    chunk_size   = chunk_size ? chunk_size : BATCH_RENAME_DEFAULT_CHUNK_SIZE;
+    max_parallel = max_parallel ? max_parallel : BATCH_RENAME_DEFAULT_MAX_PARALLEL;
+    max_parallel = MIN2 (max_parallel, BATCH_RENAME_MAX_PARALLEL);
 
-        StrIter j = StrIterInitFromStr (&gj);
+    // ring of requests in flight, chunk `i` goes in slot `i % max_parallel`
+    ApiFuture* inflight[BATCH_RENAME_MAX_PARALLEL] = {0};
+    bool       statuses[BATCH_RENAME_MAX_PARALLEL] = {0};
 
-        bool status = false;
-        JR_OBJ (j, { JR_BOOL_KV (j, "status", status); });
+    size chunks  = (functions.length + chunk_size - 1) / chunk_size;
+    size next    = 0;
+    size renamed = 0;
+    for (size done = 0; done < chunks; done++) {
+        for (; next < chunks && next - done < max_parallel; next++) {
+            size slot = next % max_parallel;
 
-        StrDeinit (&gj);
+            // a view into `functions`, request body is written before submit returns
+            FunctionInfos chunk = functions;
+            chunk.data          = VecPtrAt (&functions, next * chunk_size);
+            chunk.length        = MIN2 (chunk_size, functions.length - next * chunk_size);
 
-        return status;
-    } else {
-        return false;
+            statuses[slot] = false;
+            inflight[slot] = BatchRenameFunctionsAsync (conn, chunk, &statuses[slot], NULL, NULL);
+        }
+
+        size slot   = done % max_parallel;
+        size first  = done * chunk_size;
+        size length = MIN2 (chunk_size, functions.length - first);
+        bool ok     = inflight[slot] && ApiFutureWait (inflight[slot]) && statuses[slot];
+        ApiFutureRelease (inflight[slot]);
+        inflight[slot] = NULL;
+
+        if (ok) {
+            renamed += length;
+            for (size i = 0; results && i < length; i++) {
+                results->data[first + i] = true;
+            }
+        } else {
+            LOG_ERROR (
+                "Failed to rename functions %zu to %zu of batch.",
+                (size_t)first,
+                (size_t)(first + length - 1)
+            );
+        }
     }
+
+    return renamed;
 }
 
-bool RenameFunction (Connection* conn, FunctionId fn_id, Str new_name) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
+ApiFuture* BatchRenameFunctionsAsync (
+    Connection*   conn,
+    FunctionInfos functions,
+    bool*         status,
+    ApiCallback   callback,
+    void*         user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildBatchRenameFunctions (conn, functions, &req),
+        &req,
+        ParseStatusFlag,
+        status,
+        sizeof (*status),
+        callback,
+        user_data
+    );
+}
+
+static bool
+    BuildRenameFunction (Connection* conn, FunctionId fn_id, Str new_name, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
         return false;
     }
 
@@ -506,56 +846,72 @@ bool RenameFunction (Connection* conn, FunctionId fn_id, Str new_name) {
         return false;
     }
 
-    Str url = StrInit();
-    Str sj  = StrInit();
-
-    StrPrintf (&url, "%s/v2/functions/rename/%llu", conn->host.data, fn_id);
-    StrPrintf (&sj, "{\"new_name\":\"%s\"}", new_name.data);
+    StrPrintf (&req->url, "%s/v2/functions/rename/%llu", conn->host.data, fn_id);
+    StrPrintf (&req->body, "{\"new_name\":\"%s\"}", new_name.data);
+    req->method = "POST";
 
-    Str gj = StrInit();
-
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, &sj, &gj, "POST")) {
-        StrDeinit (&url);
-        StrDeinit (&sj);
-
-        StrIter j = StrIterInitFromStr (&gj);
-
-        bool status = false;
-        JR_OBJ (j, { JR_BOOL_KV (j, "status", status); });
+    return true;
+}
 
-        StrDeinit (&gj);
+bool RenameFunction (Connection* conn, FunctionId fn_id, Str new_name) {
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    bool       status = false;
+    Perform (
+        conn,
+        BuildRenameFunction (conn, fn_id, new_name, &req),
+        &req,
+        ParseStatusFlag,
+        &status
+    );
+    return status;
+}
 
-        return status;
-    } else {
-        return false;
-    }
+ApiFuture* RenameFunctionAsync (
+    Connection* conn,
+    FunctionId  fn_id,
+    Str         new_name,
+    bool*       status,
+    ApiCallback callback,
+    void*       user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildRenameFunction (conn, fn_id, new_name, &req),
+        &req,
+        ParseStatusFlag,
+        status,
+        sizeof (*status),
+        callback,
+        user_data
+    );
 }
 
-AnnSymbols GetBatchAnnSymbols (Connection* conn, BatchAnnSymbolRequest* request) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (AnnSymbols) {0};
+static bool
+    BuildGetBatchAnnSymbols (Connection* conn, BatchAnnSymbolRequest* request, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!request) {
         LOG_ERROR ("Invalid request");
-        return (AnnSymbols) {0};
+        return false;
     }
 
     if (!request->analysis_id) {
         LOG_ERROR ("Invalid analysis id.");
-        return (AnnSymbols) {0};
+        return false;
     }
 
-    Str url = StrInit();
-    Str sj  = StrInit();
-
     StrPrintf (
-        &url,
+        &req->url,
         "%s/v2/analyses/%llu/similarity/functions",
         conn->host.data,
         request->analysis_id
     );
+    req->method = "POST";
+
+    Str sj = req->body; // written into pooled buffer
 
     JW_OBJ (sj, {
         JW_INT_KV (sj, "limit", request->limit);
@@ -572,143 +928,222 @@ AnnSymbols GetBatchAnnSymbols (Connection* conn, BatchAnnSymbolRequest* request)
         });
     });
 
-    Str gj = StrInit();
-
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, &sj, &gj, "POST")) {
-        StrDeinit (&url);
-        StrDeinit (&sj);
+    req->body = sj;
 
-        StrIter j = StrIterInitFromStr (&gj);
+    return true;
+}
 
-        bool       status = false;
-        AnnSymbols syms   = VecInitWithDeepCopy (NULL, AnnSymbolDeinit);
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_OBJ_KV (j, "data", {
-                    FunctionId source_function_id = strtoull (key.data, NULL, 10);
-                    JR_OBJ (j, {
-                        AnnSymbol sym          = {0};
-                        sym.source_function_id = source_function_id;
-                        sym.target_function_id = strtoull (key.data, NULL, 10);
+///
+/// Read an id used as object key. Key points into the response and isn't NUL terminated,
+/// so it's read only up to its length.
+///
+static u64 IdFromKey (Str* key) {
+    StrIter ki = StrIterInitFromStr (key);
+    i64     id = 0;
+    JReadInteger (ki, &id);
+    return (u64)id;
+}
 
-                        JR_OBJ (j, {
-                            JR_FLT_KV (j, "distance", sym.distance);
-                            JR_INT_KV (j, "nearest_neighbor_analysis_id", sym.analysis_id);
-                            JR_INT_KV (j, "nearest_neighbor_binary_id", sym.binary_id);
-                            JR_STR_KV (j, "nearest_neighbor_analysis_name", sym.analysis_name);
-                            JR_STR_KV (j, "nearest_neighbor_function_name", sym.function_name);
-                            JR_STR_KV (j, "nearest_neighbor_sha_256_hash", sym.sha256);
-                            JR_BOOL_KV (j, "nearest_neighbor_debug", sym.debug);
-                            JR_STR_KV (
-                                j,
-                                "nearest_neighbor_function_name_mangled",
-                                sym.function_mangled_name
-                            );
-                        });
+static bool ParseGetBatchAnnSymbols (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    bool       status = false;
+    AnnSymbols syms   = VecInitWithDeepCopy (NULL, AnnSymbolDeinit);
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_OBJ_KV (j, "data", {
+                FunctionId source_function_id = IdFromKey (&key);
+                JR_OBJ (j, {
+                    AnnSymbol sym          = {0};
+                    sym.source_function_id = source_function_id;
+                    sym.target_function_id = IdFromKey (&key);
 
-                        LOG_INFO (
-                            "Source (%llu) -> Target (%llu) [%s]",
-                            sym.source_function_id,
-                            sym.target_function_id,
-                            sym.function_name.data
+                    JR_OBJ (j, {
+                        JR_FLT_KV (j, "distance", sym.distance);
+                        JR_INT_KV (j, "nearest_neighbor_analysis_id", sym.analysis_id);
+                        JR_INT_KV (j, "nearest_neighbor_binary_id", sym.binary_id);
+                        JR_STR_KV (j, "nearest_neighbor_analysis_name", sym.analysis_name);
+                        JR_STR_KV (j, "nearest_neighbor_function_name", sym.function_name);
+                        JR_STR_KV (j, "nearest_neighbor_sha_256_hash", sym.sha256);
+                        JR_BOOL_KV (j, "nearest_neighbor_debug", sym.debug);
+                        JR_STR_KV (
+                            j,
+                            "nearest_neighbor_function_name_mangled",
+                            sym.function_mangled_name
                         );
-
-                        VecPushBack (&syms, sym);
                     });
-                });
-            }
-        });
 
-        StrDeinit (&gj);
+                    LOG_INFO (
+                        "Source (%llu) -> Target (%llu) [%s]",
+                        sym.source_function_id,
+                        sym.target_function_id,
+                        sym.function_name.data
+                    );
+
+                    VecPushBack (&syms, sym);
+                });
+            });
+        }
+    });
 
-        return syms;
-    } else {
-        return (AnnSymbols) {0};
-    }
+    *(AnnSymbols*)out = syms;
+    return status;
 }
 
-Status GetAnalysisStatus (Connection* conn, BinaryId binary_id) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return STATUS_INVALID;
-    }
+AnnSymbols GetBatchAnnSymbols (Connection* conn, BatchAnnSymbolRequest* request) {
+    ApiRequest req  = ConnectionAcquireRequest (conn);
+    AnnSymbols syms = {0};
+    Perform (
+        conn,
+        BuildGetBatchAnnSymbols (conn, request, &req),
+        &req,
+        ParseGetBatchAnnSymbols,
+        &syms
+    );
+    return syms;
+}
 
-    Str url = StrInit();
-    Str gj  = StrInit();
+ApiFuture* GetBatchAnnSymbolsAsync (
+    Connection*            conn,
+    BatchAnnSymbolRequest* request,
+    AnnSymbols*            syms,
+    ApiCallback            callback,
+    void*                  user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetBatchAnnSymbols (conn, request, &req),
+        &req,
+        ParseGetBatchAnnSymbols,
+        syms,
+        sizeof (*syms),
+        callback,
+        user_data
+    );
+}
 
-    StrPrintf (&url, "%s/v1/analyse/status/%llu", conn->host.data, binary_id);
+static bool BuildGetAnalysisStatus (Connection* conn, BinaryId binary_id, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
+    }
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
+    StrPrintf (&req->url, "%s/v1/analyse/status/%llu", conn->host.data, binary_id);
+    req->method = "GET";
 
-        StrIter j = StrIterInitFromStr (&gj);
+    return true;
+}
 
-        bool success = false;
+static bool ParseGetAnalysisStatus (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
 
-        Str status = StrInit();
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "success", success);
-            if (success) {
-                JR_STR_KV (j, "status", status);
-            }
-        });
+    bool success = false;
+    Str  status  = StrInit();
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "success", success);
+        if (success) {
+            JR_STR_KV (j, "status", status);
+        }
+    });
 
-        StrDeinit (&gj);
+    *(Status*)out = StatusFromStr (&status);
+    StrDeinit (&status);
+    return success;
+}
 
-        Status analysis_status = StatusFromStr (&status);
-        StrDeinit (&status);
-        return analysis_status;
-    } else {
-        return STATUS_INVALID;
-    }
+Status GetAnalysisStatus (Connection* conn, BinaryId binary_id) {
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    Status     status = STATUS_INVALID;
+    Perform (
+        conn,
+        BuildGetAnalysisStatus (conn, binary_id, &req),
+        &req,
+        ParseGetAnalysisStatus,
+        &status
+    );
+    return status;
 }
 
+ApiFuture* GetAnalysisStatusAsync (
+    Connection* conn,
+    BinaryId    binary_id,
+    Status*     status,
+    ApiCallback callback,
+    void*       user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetAnalysisStatus (conn, binary_id, &req),
+        &req,
+        ParseGetAnalysisStatus,
+        status,
+        sizeof (*status),
+        callback,
+        user_data
+    );
+}
 
-ModelInfos GetAiModelInfos (Connection* conn) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (ModelInfos) {0};
+static bool BuildGetAiModelInfos (Connection* conn, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
-
-    StrPrintf (&url, "%s/v1/models", conn->host.data);
+    StrPrintf (&req->url, "%s/v1/models", conn->host.data);
+    req->method = "GET";
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
+    return true;
+}
 
-        StrIter j = StrIterInitFromStr (&gj);
+static bool ParseGetAiModelInfos (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
 
-        bool       success = false;
-        ModelInfos models  = VecInitWithDeepCopy (NULL, ModelInfoDeinit);
+    bool       success = false;
+    ModelInfos models  = VecInitWithDeepCopy (NULL, ModelInfoDeinit);
 
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "success", success);
-            if (success) {
-                JR_ARR_KV (j, "models", {
-                    ModelInfo model = {0};
-                    JR_OBJ (j, {
-                        JR_INT_KV (j, "model_id", model.id);
-                        JR_STR_KV (j, "model_name", model.name);
-                    });
-                    VecPushBack (&models, model);
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "success", success);
+        if (success) {
+            JR_ARR_KV (j, "models", {
+                ModelInfo model = {0};
+                JR_OBJ (j, {
+                    JR_INT_KV (j, "model_id", model.id);
+                    JR_STR_KV (j, "model_name", model.name);
                 });
-            }
-        });
+                VecPushBack (&models, model);
+            });
+        }
+    });
 
-        StrDeinit (&gj);
+    *(ModelInfos*)out = models;
+    return success;
+}
 
-        return models;
-    } else {
-        return (ModelInfos) {0};
-    }
+ModelInfos GetAiModelInfos (Connection* conn) {
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    ModelInfos models = {0};
+    Perform (conn, BuildGetAiModelInfos (conn, &req), &req, ParseGetAiModelInfos, &models);
+    return models;
 }
 
-bool BeginAiDecompilation (Connection* conn, FunctionId function_id) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
+ApiFuture*
+    GetAiModelInfosAsync (Connection* conn, ModelInfos* models, ApiCallback callback, void* user_data) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetAiModelInfos (conn, &req),
+        &req,
+        ParseGetAiModelInfos,
+        models,
+        sizeof (*models),
+        callback,
+        user_data
+    );
+}
+
+static bool BuildBeginAiDecompilation (Connection* conn, FunctionId function_id, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
         return false;
     }
 
@@ -717,71 +1152,275 @@ bool BeginAiDecompilation (Connection* conn, FunctionId function_id) {
         return false;
     }
 
-    Str url = StrInit();
-
-    StrPrintf (&url, "%s/v2/functions/%llu/ai-decompilation", conn->host.data, function_id);
-
-    Str gj = StrInit();
+    StrPrintf (&req->url, "%s/v2/functions/%llu/ai-decompilation", conn->host.data, function_id);
+    req->method = "POST";
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "POST")) {
-        StrDeinit (&url);
+    return true;
+}
 
-        StrIter j = StrIterInitFromStr (&gj);
+bool BeginAiDecompilation (Connection* conn, FunctionId function_id) {
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    bool       status = false;
+    Perform (
+        conn,
+        BuildBeginAiDecompilation (conn, function_id, &req),
+        &req,
+        ParseStatusFlag,
+        &status
+    );
+    return status;
+}
 
-        bool status = false;
-        JR_OBJ (j, { JR_BOOL_KV (j, "status", status); });
+ApiFuture* BeginAiDecompilationAsync (
+    Connection* conn,
+    FunctionId  function_id,
+    bool*       status,
+    ApiCallback callback,
+    void*       user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildBeginAiDecompilation (conn, function_id, &req),
+        &req,
+        ParseStatusFlag,
+        status,
+        sizeof (*status),
+        callback,
+        user_data
+    );
+}
 
-        StrDeinit (&gj);
+static bool
+    BuildGetAiDecompilationStatus (Connection* conn, FunctionId function_id, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
+    }
 
-        return status;
-    } else {
+    if (!function_id) {
+        LOG_ERROR ("Invalid function id.");
         return false;
     }
+
+    StrPrintf (
+        &req->url,
+        "%s/v2/functions/%llu/ai-decompilation/status",
+        conn->host.data,
+        function_id
+    );
+    req->method = "GET";
+
+    return true;
+}
+
+static bool ParseGetAiDecompilationStatus (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    bool status     = false;
+    Str  status_str = StrInit();
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_OBJ_KV (j, "data", { JR_STR_KV (j, "status", status_str); });
+        }
+    });
+
+    *(Status*)out = StatusFromStr (&status_str);
+    StrDeinit (&status_str);
+    return status;
 }
 
 Status GetAiDecompilationStatus (Connection* conn, FunctionId function_id) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return STATUS_INVALID;
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    Status     status = STATUS_INVALID;
+    Perform (
+        conn,
+        BuildGetAiDecompilationStatus (conn, function_id, &req),
+        &req,
+        ParseGetAiDecompilationStatus,
+        &status
+    );
+    return status;
+}
+
+ApiFuture* GetAiDecompilationStatusAsync (
+    Connection* conn,
+    FunctionId  function_id,
+    Status*     status,
+    ApiCallback callback,
+    void*       user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetAiDecompilationStatus (conn, function_id, &req),
+        &req,
+        ParseGetAiDecompilationStatus,
+        status,
+        sizeof (*status),
+        callback,
+        user_data
+    );
+}
+
+static bool BuildGetAiDecompilation (
+    Connection* conn,
+    FunctionId  function_id,
+    bool        get_ai_summary,
+    ApiRequest* req
+) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!function_id) {
         LOG_ERROR ("Invalid function id.");
-        return STATUS_INVALID;
+        return false;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
+    StrPrintf (&req->url, "%s/v2/functions/%llu/ai-decompilation", conn->host.data, function_id);
+    UrlAddQueryBool (&req->url, "summarise", get_ai_summary, NULL);
+    req->method = "GET";
+
+    return true;
+}
 
-    StrPrintf (&url, "%s/v2/functions/%llu/ai-decompilation/status", conn->host.data, function_id);
+static bool ParseGetAiDecompilation (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    bool            status   = false;
+    AiDecompilation decomp   = {0};
+    decomp.decompilation     = StrInit();
+    decomp.raw_decompilation = StrInit();
+    decomp.ai_summary        = StrInit();
+    decomp.raw_ai_summary    = StrInit();
+    decomp.functions         = VecInitWithDeepCopy_T (&decomp.functions, NULL, SymbolInfoDeinit);
+    decomp.strings           = VecInitWithDeepCopy_T (&decomp.strings, NULL, SymbolInfoDeinit);
+    decomp.unmatched.strings =
+        VecInitWithDeepCopy_T (&decomp.unmatched.strings, NULL, SymbolInfoDeinit);
+    decomp.unmatched.functions =
+        VecInitWithDeepCopy_T (&decomp.unmatched.functions, NULL, SymbolInfoDeinit);
+    decomp.unmatched.vars = VecInitWithDeepCopy_T (&decomp.unmatched.vars, NULL, SymbolInfoDeinit);
+    decomp.unmatched.external_vars =
+        VecInitWithDeepCopy_T (&decomp.unmatched.external_vars, NULL, SymbolInfoDeinit);
+    decomp.unmatched.custom_types =
+        VecInitWithDeepCopy_T (&decomp.unmatched.custom_types, NULL, SymbolInfoDeinit);
+    decomp.unmatched.go_to_labels =
+        VecInitWithDeepCopy_T (&decomp.unmatched.go_to_labels, NULL, SymbolInfoDeinit);
+    decomp.unmatched.custom_function_pointers = VecInitWithDeepCopy_T (
+        &decomp.unmatched.custom_function_pointers,
+        NULL,
+        SymbolInfoDeinit
+    );
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
+    decomp.unmatched.variadic_lists =
+        VecInitWithDeepCopy_T (&decomp.unmatched.variadic_lists, NULL, SymbolInfoDeinit);
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_OBJ_KV (j, "data", {
+                JR_STR_KV (j, "decompilation", decomp.decompilation);
+                JR_STR_KV (j, "raw_decompilation", decomp.raw_decompilation);
+                JR_STR_KV (j, "ai_summary", decomp.ai_summary);
+                JR_STR_KV (j, "raw_ai_summary", decomp.raw_ai_summary);
+                JR_OBJ_KV (j, "function_mapping_full", {
+                    JR_OBJ_KV (j, "inverse_string_map", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = true;
+                        JR_OBJ (j, {
+                            JR_STR_KV (j, "string", sym.string);
+                            JR_INT_KV (j, "addr", sym.value.addr);
+                        });
+                        VecPushBack (&decomp.strings, sym);
+                    });
 
-        StrIter j = StrIterInitFromStr (&gj);
+                    JR_OBJ_KV (j, "inverse_function_map", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = true;
+                        JR_OBJ (j, {
+                            JR_STR_KV (j, "name", sym.name);
+                            JR_INT_KV (j, "addr", sym.value.addr);
+                            JR_BOOL_KV (j, "is_external", sym.is_external);
+                        });
+                        VecPushBack (&decomp.functions, sym);
+                    });
 
-        bool status     = false;
-        Str  status_str = StrInit();
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_OBJ_KV (j, "data", { JR_STR_KV (j, "status", status_str); });
-            }
-        });
+                    JR_OBJ_KV (j, "unmatched_functions", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = false;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.functions, sym);
+                    });
 
-        StrDeinit (&gj);
+                    JR_OBJ_KV (j, "unmatched_external_vars", {
+                        SymbolInfo sym  = {0};
+                        sym.is_addr     = false;
+                        sym.is_external = true;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.external_vars, sym);
+                    });
 
-        Status decomp_status = StatusFromStr (&status_str);
-        StrDeinit (&status_str);
-        return decomp_status;
-    } else {
-        return STATUS_INVALID;
-    }
+                    JR_OBJ_KV (j, "unmatched_custom_types", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = false;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.custom_types, sym);
+                    });
+
+                    JR_OBJ_KV (j, "unmatched_strings", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = false;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.strings, sym);
+                    });
+
+                    JR_OBJ_KV (j, "unmatched_vars", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = false;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.vars, sym);
+                    });
+
+                    JR_OBJ_KV (j, "unmatched_go_to_labels", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = false;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.go_to_labels, sym);
+                    });
+
+                    JR_OBJ_KV (j, "unmatched_custom_function_pointers", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = false;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.custom_function_pointers, sym);
+                    });
+
+                    JR_OBJ_KV (j, "unmatched_variadic_lists", {
+                        SymbolInfo sym = {0};
+                        sym.is_addr    = false;
+                        StrInitCopy (&sym.name, &key);
+                        JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
+                        VecPushBack (&decomp.unmatched.variadic_lists, sym);
+                    });
+                });
+                // NOTE: Fields skipped
+            });
+        }
+    });
+
+    *(AiDecompilation*)out = decomp;
+    return status;
 }
 
 AiDecompilation GetAiDecompilation (Connection* conn, FunctionId function_id, bool get_ai_summary) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
+    if (!CheckConnection (conn)) {
         return (AiDecompilation) {0};
     }
 
@@ -790,8 +1429,15 @@ AiDecompilation GetAiDecompilation (Connection* conn, FunctionId function_id, bo
         return (AiDecompilation) {0};
     }
 
-    i32 MAX_RETRIES = 20;
-    while (MAX_RETRIES--) {
+    PollerOptions backoff = PollerOptionsInit();
+    u64           started = SysGetMonotonicTimeMs();
+    bool          ready   = false;
+    for (u32 attempt = 1; !ready; attempt++) {
+        if (RequestOptionsExpired (conn->options)) {
+            LOG_ERROR ("Gave up waiting for AI decompilation, call got cancelled or timed out.");
+            return (AiDecompilation) {0};
+        }
+
         Status status = GetAiDecompilationStatus (conn, function_id);
         switch (status & STATUS_MASK) {
             case STATUS_UNINITIALIZED : {
@@ -800,6 +1446,19 @@ AiDecompilation GetAiDecompilation (Connection* conn, FunctionId function_id, bo
             }
 
             case STATUS_PENDING : {
+                if (SysGetMonotonicTimeMs() - started >= backoff.timeout_ms) {
+                    LOG_ERROR ("Gave up waiting for AI decompilation, still pending.");
+                    return (AiDecompilation) {0};
+                }
+
+                // back off before polling again, noticing cancellation meanwhile
+                u64 wait  = PollerBackoff (&backoff, attempt, function_id);
+                u64 until = SysGetMonotonicTimeMs() + wait;
+                for (u64 now = SysGetMonotonicTimeMs();
+                     now < until && !RequestOptionsExpired (conn->options);
+                     now = SysGetMonotonicTimeMs()) {
+                    SysSleepMs (MIN2 (until - now, 50));
+                }
                 break;
             }
 
@@ -809,773 +1468,844 @@ AiDecompilation GetAiDecompilation (Connection* conn, FunctionId function_id, bo
             }
 
             case STATUS_SUCCESS : {
-                MAX_RETRIES = 0;
+                ready = true;
                 break;
             }
 
             default : {
-                LOG_FATAL ("Unreachable code.");
+                LOG_ERROR ("Failed to get AI decompilation status.");
+                return (AiDecompilation) {0};
             }
         }
     }
 
-    Str url = StrInit();
-
-    StrPrintf (&url, "%s/v2/functions/%llu/ai-decompilation", conn->host.data, function_id);
-    UrlAddQueryBool (&url, "summarise", get_ai_summary, NULL);
-
-    Str gj = StrInit();
-
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
-
-        StrIter j = StrIterInitFromStr (&gj);
-
-        bool            status   = false;
-        AiDecompilation decomp   = {0};
-        decomp.decompilation     = StrInit();
-        decomp.raw_decompilation = StrInit();
-        decomp.ai_summary        = StrInit();
-        decomp.raw_ai_summary    = StrInit();
-        decomp.functions = VecInitWithDeepCopy_T (&decomp.functions, NULL, SymbolInfoDeinit);
-        decomp.strings   = VecInitWithDeepCopy_T (&decomp.strings, NULL, SymbolInfoDeinit);
-        decomp.unmatched.strings =
-            VecInitWithDeepCopy_T (&decomp.unmatched.strings, NULL, SymbolInfoDeinit);
-        decomp.unmatched.functions =
-            VecInitWithDeepCopy_T (&decomp.unmatched.functions, NULL, SymbolInfoDeinit);
-        decomp.unmatched.vars =
-            VecInitWithDeepCopy_T (&decomp.unmatched.vars, NULL, SymbolInfoDeinit);
-        decomp.unmatched.external_vars =
-            VecInitWithDeepCopy_T (&decomp.unmatched.external_vars, NULL, SymbolInfoDeinit);
-        decomp.unmatched.custom_types =
-            VecInitWithDeepCopy_T (&decomp.unmatched.custom_types, NULL, SymbolInfoDeinit);
-        decomp.unmatched.go_to_labels =
-            VecInitWithDeepCopy_T (&decomp.unmatched.go_to_labels, NULL, SymbolInfoDeinit);
-        decomp.unmatched.custom_function_pointers = VecInitWithDeepCopy_T (
-            &decomp.unmatched.custom_function_pointers,
-            NULL,
-            SymbolInfoDeinit
-        );
-
-        decomp.unmatched.variadic_lists =
-            VecInitWithDeepCopy_T (&decomp.unmatched.variadic_lists, NULL, SymbolInfoDeinit);
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_OBJ_KV (j, "data", {
-                    JR_STR_KV (j, "decompilation", decomp.decompilation);
-                    JR_STR_KV (j, "raw_decompilation", decomp.raw_decompilation);
-                    JR_STR_KV (j, "ai_summary", decomp.ai_summary);
-                    JR_STR_KV (j, "raw_ai_summary", decomp.raw_ai_summary);
-                    JR_OBJ_KV (j, "function_mapping_full", {
-                        JR_OBJ_KV (j, "inverse_string_map", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = true;
-                            JR_OBJ (j, {
-                                JR_STR_KV (j, "string", sym.string);
-                                JR_INT_KV (j, "addr", sym.value.addr);
-                            });
-                            VecPushBack (&decomp.strings, sym);
-                        });
+    ApiRequest      req    = ConnectionAcquireRequest (conn);
+    AiDecompilation decomp = {0};
+    Perform (
+        conn,
+        BuildGetAiDecompilation (conn, function_id, get_ai_summary, &req),
+        &req,
+        ParseGetAiDecompilation,
+        &decomp
+    );
+    return decomp;
+}
 
-                        JR_OBJ_KV (j, "inverse_function_map", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = true;
-                            JR_OBJ (j, {
-                                JR_STR_KV (j, "name", sym.name);
-                                JR_INT_KV (j, "addr", sym.value.addr);
-                                JR_BOOL_KV (j, "is_external", sym.is_external);
-                            });
-                            VecPushBack (&decomp.functions, sym);
-                        });
+///
+/// State of an asynchronous AI decompilation : status polls with backoff, followed by a fetch.
+///
+typedef struct AiDecompilationChain {
+    Connection       conn; /**< @b Copy of host and API key, used to build next requests. */
+    FunctionId       function_id;
+    bool             get_ai_summary;
+    PollerOptions    backoff;
+    u64              started;  /**< @b When first status poll was made. */
+    u32              attempts; /**< @b Status polls made so far. */
+    bool             fetching;
+    AiDecompilation* decomp;
+} AiDecompilationChain;
+
+static void AiDecompilationChainDeinit (void* ctx) {
+    AiDecompilationChain* chain = (AiDecompilationChain*)ctx;
+    StrDeinit (&chain->conn.host);
+    StrDeinit (&chain->conn.api_key);
+    FREE (chain);
+}
 
-                        JR_OBJ_KV (j, "unmatched_functions", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = false;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.functions, sym);
-                        });
+static ApiStep AiDecompilationChainNext (Str* response, ApiRequest* next, void* ctx) {
+    AiDecompilationChain* chain = (AiDecompilationChain*)ctx;
 
-                        JR_OBJ_KV (j, "unmatched_external_vars", {
-                            SymbolInfo sym  = {0};
-                            sym.is_addr     = false;
-                            sym.is_external = true;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.external_vars, sym);
-                        });
+    if (chain->fetching) {
+        return ParseGetAiDecompilation (response, chain->decomp) ? API_STEP_DONE : API_STEP_FAILED;
+    }
 
-                        JR_OBJ_KV (j, "unmatched_custom_types", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = false;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.custom_types, sym);
-                        });
+    Status status = STATUS_INVALID;
+    ParseGetAiDecompilationStatus (response, &status);
+    switch (status & STATUS_MASK) {
+        case STATUS_UNINITIALIZED : {
+            LOG_ERROR ("Ai decompilation not started yet.");
+            return API_STEP_FAILED;
+        }
 
-                        JR_OBJ_KV (j, "unmatched_strings", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = false;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.strings, sym);
-                        });
+        case STATUS_PENDING : {
+            if (SysGetMonotonicTimeMs() - chain->started >= chain->backoff.timeout_ms) {
+                LOG_ERROR ("Gave up waiting for AI decompilation, still pending.");
+                return API_STEP_FAILED;
+            }
 
-                        JR_OBJ_KV (j, "unmatched_vars", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = false;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.vars, sym);
-                        });
+            // poll again after a while, same as the blocking call does
+            if (!BuildGetAiDecompilationStatus (&chain->conn, chain->function_id, next)) {
+                return API_STEP_FAILED;
+            }
+            next->delay_ms = PollerBackoff (&chain->backoff, ++chain->attempts, chain->function_id);
+            return API_STEP_NEXT;
+        }
 
-                        JR_OBJ_KV (j, "unmatched_go_to_labels", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = false;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.go_to_labels, sym);
-                        });
+        case STATUS_ERROR : {
+            LOG_ERROR ("Last AI decompilation errored out. Restart.");
+            return API_STEP_FAILED;
+        }
 
-                        JR_OBJ_KV (j, "unmatched_custom_function_pointers", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = false;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.custom_function_pointers, sym);
-                        });
+        case STATUS_SUCCESS : {
+            break;
+        }
 
-                        JR_OBJ_KV (j, "unmatched_variadic_lists", {
-                            SymbolInfo sym = {0};
-                            sym.is_addr    = false;
-                            StrInitCopy (&sym.name, &key);
-                            JR_OBJ (j, { JR_STR_KV (j, "value", sym.value.str); });
-                            VecPushBack (&decomp.unmatched.variadic_lists, sym);
-                        });
-                    });
-                    // NOTE: Fields skipped
-                });
-            }
-        });
+        default : {
+            LOG_ERROR ("Invalid AI decompilation status.");
+            return API_STEP_FAILED;
+        }
+    }
 
-        StrDeinit (&gj);
-        return decomp;
-    } else {
-        return (AiDecompilation) {0};
+    chain->fetching = true;
+    return BuildGetAiDecompilation (&chain->conn, chain->function_id, chain->get_ai_summary, next) ?
+               API_STEP_NEXT :
+               API_STEP_FAILED;
+}
+
+ApiFuture* GetAiDecompilationAsync (
+    Connection*      conn,
+    FunctionId       function_id,
+    bool             get_ai_summary,
+    AiDecompilation* decomp,
+    ApiCallback      callback,
+    void*            user_data
+) {
+    if (!decomp) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
     }
+
+    // left zeroed if chain fails before decompilation is fetched, as blocking variant returns
+    *decomp = (AiDecompilation) {0};
+
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    if (!BuildGetAiDecompilationStatus (conn, function_id, &req)) {
+        ConnectionReleaseRequest (conn, &req);
+        return NULL;
+    }
+
+    AiDecompilationChain* chain = NEW (AiDecompilationChain);
+    if (!chain) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    StrInitCopy (&chain->conn.host, &conn->host);
+    StrInitCopy (&chain->conn.api_key, &conn->api_key);
+    chain->function_id    = function_id;
+    chain->get_ai_summary = get_ai_summary;
+    chain->backoff        = (PollerOptions)PollerOptionsInit();
+    chain->started        = SysGetMonotonicTimeMs();
+    chain->decomp         = decomp;
+
+    return ConnectionSubmitChain (
+        conn,
+        &req,
+        AiDecompilationChainNext,
+        chain,
+        AiDecompilationChainDeinit,
+        callback,
+        user_data
+    );
 }
 
-ControlFlowGraph GetFunctionControlFlowGraph (Connection* conn, FunctionId function_id) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (ControlFlowGraph) {0};
+static bool
+    BuildGetFunctionControlFlowGraph (Connection* conn, FunctionId function_id, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!function_id) {
         LOG_ERROR ("Invalid function id.");
-        return (ControlFlowGraph) {0};
+        return false;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
-
-    StrPrintf (&url, "%s/v2/functions/%llu/blocks", conn->host.data, function_id);
-
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
+    StrPrintf (&req->url, "%s/v2/functions/%llu/blocks", conn->host.data, function_id);
+    req->method = "GET";
 
-        StrIter j = StrIterInitFromStr (&gj);
+    return true;
+}
 
-        bool             status = false;
-        ControlFlowGraph cfg    = {0};
-        cfg.blocks              = VecInitWithDeepCopy_T (&cfg.blocks, NULL, BlockDeinit);
-        cfg.local_variables =
-            VecInitWithDeepCopy_T (&cfg.local_variables, NULL, LocalVariableDeinit);
-        cfg.overview_comment = StrInit();
+static bool ParseGetFunctionControlFlowGraph (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    bool             status = false;
+    ControlFlowGraph cfg    = {0};
+    cfg.blocks              = VecInitWithDeepCopy_T (&cfg.blocks, NULL, BlockDeinit);
+    cfg.local_variables  = VecInitWithDeepCopy_T (&cfg.local_variables, NULL, LocalVariableDeinit);
+    cfg.overview_comment = StrInit();
+
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_OBJ_KV (j, "data", {
+                JR_ARR_KV (j, "blocks", {
+                    Block block     = {0};
+                    block.asm_lines = VecInitWithDeepCopy_T (&block.asm_lines, NULL, StrDeinit);
+                    block.destinations =
+                        VecInitWithDeepCopy_T (&block.destinations, NULL, DestinationDeinit);
+                    block.comment = StrInit();
 
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_OBJ_KV (j, "data", {
-                    JR_ARR_KV (j, "blocks", {
-                        Block block     = {0};
-                        block.asm_lines = VecInitWithDeepCopy_T (&block.asm_lines, NULL, StrDeinit);
-                        block.destinations =
-                            VecInitWithDeepCopy_T (&block.destinations, NULL, DestinationDeinit);
-                        block.comment = StrInit();
+                    JR_OBJ (j, {
+                        JR_ARR_KV (j, "asm", {
+                            Str asm_line = StrInit();
+                            JR_STR (j, asm_line);
+                            VecPushBack (&block.asm_lines, asm_line);
+                        });
+                        JR_INT_KV (j, "id", block.id);
+                        JR_INT_KV (j, "min_addr", block.min_addr);
+                        JR_INT_KV (j, "max_addr", block.max_addr);
+                        JR_ARR_KV (j, "destinations", {
+                            Destination dest = {0};
+                            dest.flowtype    = StrInit();
+                            dest.vaddr       = StrInit();
 
-                        JR_OBJ (j, {
-                            JR_ARR_KV (j, "asm", {
-                                Str asm_line = StrInit();
-                                JR_STR (j, asm_line);
-                                VecPushBack (&block.asm_lines, asm_line);
-                            });
-                            JR_INT_KV (j, "id", block.id);
-                            JR_INT_KV (j, "min_addr", block.min_addr);
-                            JR_INT_KV (j, "max_addr", block.max_addr);
-                            JR_ARR_KV (j, "destinations", {
-                                Destination dest = {0};
-                                dest.flowtype    = StrInit();
-                                dest.vaddr       = StrInit();
-
-                                JR_OBJ (j, {
-                                    JR_INT_KV (
-                                        j,
-                                        "destination_block_id",
-                                        dest.destination_block_id
-                                    );
-                                    JR_STR_KV (j, "flowtype", dest.flowtype);
-                                    JR_STR_KV (j, "vaddr", dest.vaddr);
-                                });
-                                VecPushBack (&block.destinations, dest);
+                            JR_OBJ (j, {
+                                JR_INT_KV (j, "destination_block_id", dest.destination_block_id);
+                                JR_STR_KV (j, "flowtype", dest.flowtype);
+                                JR_STR_KV (j, "vaddr", dest.vaddr);
                             });
-                            JR_STR_KV (j, "comment", block.comment);
+                            VecPushBack (&block.destinations, dest);
                         });
-                        VecPushBack (&cfg.blocks, block);
+                        JR_STR_KV (j, "comment", block.comment);
                     });
+                    VecPushBack (&cfg.blocks, block);
+                });
 
-                    JR_ARR_KV (j, "local_variables", {
-                        LocalVariable var = {0};
-                        var.address       = StrInit();
-                        var.d_type        = StrInit();
-                        var.loc           = StrInit();
-                        var.name          = StrInit();
+                JR_ARR_KV (j, "local_variables", {
+                    LocalVariable var = {0};
+                    var.address       = StrInit();
+                    var.d_type        = StrInit();
+                    var.loc           = StrInit();
+                    var.name          = StrInit();
 
-                        JR_OBJ (j, {
-                            JR_STR_KV (j, "address", var.address);
-                            JR_STR_KV (j, "d_type", var.d_type);
-                            JR_INT_KV (j, "size", var.size);
-                            JR_STR_KV (j, "loc", var.loc);
-                            JR_STR_KV (j, "name", var.name);
-                        });
-                        VecPushBack (&cfg.local_variables, var);
+                    JR_OBJ (j, {
+                        JR_STR_KV (j, "address", var.address);
+                        JR_STR_KV (j, "d_type", var.d_type);
+                        JR_INT_KV (j, "size", var.size);
+                        JR_STR_KV (j, "loc", var.loc);
+                        JR_STR_KV (j, "name", var.name);
                     });
-
-                    JR_STR_KV (j, "overview_comment", cfg.overview_comment);
+                    VecPushBack (&cfg.local_variables, var);
                 });
-            }
-        });
 
-        StrDeinit (&gj);
-        return cfg;
-    } else {
-        return (ControlFlowGraph) {0};
-    }
+                JR_STR_KV (j, "overview_comment", cfg.overview_comment);
+            });
+        }
+    });
+
+    *(ControlFlowGraph*)out = cfg;
+    return status;
 }
 
-SimilarFunctions GetSimilarFunctions (Connection* conn, SimilarFunctionsRequest* request) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (SimilarFunctions) {0};
+ControlFlowGraph GetFunctionControlFlowGraph (Connection* conn, FunctionId function_id) {
+    ApiRequest       req = ConnectionAcquireRequest (conn);
+    ControlFlowGraph cfg = {0};
+    Perform (
+        conn,
+        BuildGetFunctionControlFlowGraph (conn, function_id, &req),
+        &req,
+        ParseGetFunctionControlFlowGraph,
+        &cfg
+    );
+    return cfg;
+}
+
+ApiFuture* GetFunctionControlFlowGraphAsync (
+    Connection*       conn,
+    FunctionId        function_id,
+    ControlFlowGraph* cfg,
+    ApiCallback       callback,
+    void*             user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetFunctionControlFlowGraph (conn, function_id, &req),
+        &req,
+        ParseGetFunctionControlFlowGraph,
+        cfg,
+        sizeof (*cfg),
+        callback,
+        user_data
+    );
+}
+
+static bool
+    BuildGetSimilarFunctions (Connection* conn, SimilarFunctionsRequest* request, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!request) {
         LOG_ERROR ("Invalid request");
-        return (SimilarFunctions) {0};
+        return false;
     }
 
     if (!request->function_id) {
         LOG_ERROR ("Invalid function id.");
-        return (SimilarFunctions) {0};
+        return false;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
-
+    Str* url = &req->url;
     StrPrintf (
-        &url,
+        url,
         "%s/v2/functions/%llu/similar-functions",
         conn->host.data,
         request->function_id
     );
+    req->method = "GET";
 
     bool is_first = true;
-    UrlAddQueryInt (&url, "limit", request->limit, &is_first);
-    UrlAddQueryFloat (&url, "distance", request->distance, &is_first);
+    UrlAddQueryInt (url, "limit", request->limit, &is_first);
+    UrlAddQueryFloat (url, "distance", request->distance, &is_first);
     VecForeach (&request->collection_ids, id, {
-        UrlAddQueryInt (&url, "collection_ids", id, &is_first);
+        UrlAddQueryInt (url, "collection_ids", id, &is_first);
     });
-    VecForeach (&request->binary_ids, id, { UrlAddQueryInt (&url, "binary_ids", id, &is_first); });
+    VecForeach (&request->binary_ids, id, { UrlAddQueryInt (url, "binary_ids", id, &is_first); });
     UrlAddQueryBool (
-        &url,
+        url,
         "debug",
         (request->debug_include.external_symbols || request->debug_include.system_symbols ||
          request->debug_include.user_symbols),
         &is_first
     );
     if (request->debug_include.user_symbols) {
-        UrlAddQueryStr (&url, "debug_types", "USER", &is_first);
+        UrlAddQueryStr (url, "debug_types", "USER", &is_first);
     }
     if (request->debug_include.system_symbols) {
-        UrlAddQueryStr (&url, "debug_types", "SYSTEM", &is_first);
+        UrlAddQueryStr (url, "debug_types", "SYSTEM", &is_first);
     }
     if (request->debug_include.external_symbols) {
-        UrlAddQueryStr (&url, "debug_types", "EXTERNAL", &is_first);
+        UrlAddQueryStr (url, "debug_types", "EXTERNAL", &is_first);
     }
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
-
-        StrIter j = StrIterInitFromStr (&gj);
+    return true;
+}
 
-        bool             status    = false;
-        SimilarFunctions functions = VecInitWithDeepCopy (NULL, SimilarFunctionDeinit);
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_ARR_KV (j, "data", {
-                    SimilarFunction f = {0};
-                    f.projection      = VecInit_T (&f.projection);
-                    JR_OBJ (j, {
-                        JR_INT_KV (j, "function_id", f.id);
-                        JR_STR_KV (j, "function_name", f.name);
-                        JR_INT_KV (j, "binary_id", f.binary_id);
-                        JR_STR_KV (j, "binary_name", f.binary_name);
-                        JR_FLT_KV (j, "distance", f.distance);
-                        JR_ARR_KV (j, "projection", {
-                            f64 p = 0;
-                            JR_FLT (j, p);
-                            VecPushBack (&f.projection, p);
-                        });
-                        JR_STR_KV (j, "sha_256_hash", f.sha256);
+static bool ParseGetSimilarFunctions (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
+
+    bool             status    = false;
+    SimilarFunctions functions = VecInitWithDeepCopy (NULL, SimilarFunctionDeinit);
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_ARR_KV (j, "data", {
+                SimilarFunction f = {0};
+                f.projection      = VecInit_T (&f.projection);
+                JR_OBJ (j, {
+                    JR_INT_KV (j, "function_id", f.id);
+                    JR_STR_KV (j, "function_name", f.name);
+                    JR_INT_KV (j, "binary_id", f.binary_id);
+                    JR_STR_KV (j, "binary_name", f.binary_name);
+                    JR_FLT_KV (j, "distance", f.distance);
+                    JR_ARR_KV (j, "projection", {
+                        f64 p = 0;
+                        JR_FLT (j, p);
+                        VecPushBack (&f.projection, p);
                     });
+                    JR_STR_KV (j, "sha_256_hash", f.sha256);
+                });
 
-                    // XXX: This is a bug in API. API sends "distance" with value of "similarity"
-                    // and below is a fix for that
-                    f.distance = 1 - f.distance;
-                    LOG_INFO ("Fixed distance = %f", f.distance);
+                // XXX: This is a bug in API. API sends "distance" with value of "similarity"
+                // and below is a fix for that
+                f.distance = 1 - f.distance;
+                LOG_INFO ("Fixed distance = %f", f.distance);
 
-                    VecPushBack (&functions, f);
-                });
-            }
-        });
+                VecPushBack (&functions, f);
+            });
+        }
+    });
 
-        StrDeinit (&gj);
-        return functions;
-    } else {
-        return (SimilarFunctions) {0};
-    }
+    *(SimilarFunctions*)out = functions;
+    return status;
 }
 
-AnalysisId AnalysisIdFromBinaryId (Connection* conn, BinaryId binary_id) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return 0;
+SimilarFunctions GetSimilarFunctions (Connection* conn, SimilarFunctionsRequest* request) {
+    ApiRequest       req       = ConnectionAcquireRequest (conn);
+    SimilarFunctions functions = {0};
+    Perform (
+        conn,
+        BuildGetSimilarFunctions (conn, request, &req),
+        &req,
+        ParseGetSimilarFunctions,
+        &functions
+    );
+    return functions;
+}
+
+ApiFuture* GetSimilarFunctionsAsync (
+    Connection*              conn,
+    SimilarFunctionsRequest* request,
+    SimilarFunctions*        functions,
+    ApiCallback              callback,
+    void*                    user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetSimilarFunctions (conn, request, &req),
+        &req,
+        ParseGetSimilarFunctions,
+        functions,
+        sizeof (*functions),
+        callback,
+        user_data
+    );
+}
+
+static bool BuildAnalysisIdFromBinaryId (Connection* conn, BinaryId binary_id, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!binary_id) {
         LOG_ERROR ("Invalid binary id");
-        return 0;
+        return false;
     }
 
-    Str url = StrInit();
-    Str gj  = StrInit();
+    StrPrintf (&req->url, "%s/v2/analyses/lookup/%llu", conn->host.data, binary_id);
+    req->method = "GET";
 
-    StrPrintf (&url, "%s/v2/analyses/lookup/%llu", conn->host.data, binary_id);
+    return true;
+}
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
+static bool ParseAnalysisIdFromBinaryId (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
 
-        StrIter j = StrIterInitFromStr (&gj);
+    AnalysisId id = 0;
+    JR_OBJ (j, { JR_INT_KV (j, "analysis_id", id); });
+    LOG_INFO ("Analysis ID = %llu", id);
 
-        AnalysisId id = 0;
-        JR_OBJ (j, { JR_INT_KV (j, "analysis_id", id); });
-        LOG_INFO ("Analysis ID = %llu", id);
+    *(AnalysisId*)out = id;
+    return !!id;
+}
 
-        StrDeinit (&gj);
+AnalysisId AnalysisIdFromBinaryId (Connection* conn, BinaryId binary_id) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    AnalysisId id  = 0;
+    Perform (
+        conn,
+        BuildAnalysisIdFromBinaryId (conn, binary_id, &req),
+        &req,
+        ParseAnalysisIdFromBinaryId,
+        &id
+    );
+    return id;
+}
 
-        return id;
-    } else {
-        return 0;
-    }
+ApiFuture* AnalysisIdFromBinaryIdAsync (
+    Connection* conn,
+    BinaryId    binary_id,
+    AnalysisId* analysis_id,
+    ApiCallback callback,
+    void*       user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildAnalysisIdFromBinaryId (conn, binary_id, &req),
+        &req,
+        ParseAnalysisIdFromBinaryId,
+        analysis_id,
+        sizeof (*analysis_id),
+        callback,
+        user_data
+    );
 }
 
-Str GetAnalysisLogs (Connection* conn, AnalysisId analysis_id) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (Str) {0};
+static bool BuildGetAnalysisLogs (Connection* conn, AnalysisId analysis_id, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!analysis_id) {
         LOG_ERROR ("Invalid analysis id");
-        return (Str) {0};
+        return false;
     }
 
-    Str url = StrInit();
-    StrPrintf (&url, "%s/v2/analyses/%llu/logs", conn->host.data, analysis_id);
+    StrPrintf (&req->url, "%s/v2/analyses/%llu/logs", conn->host.data, analysis_id);
+    req->method = "GET";
 
-    Str gj = StrInit();
+    return true;
+}
 
-    if (MakeRequest (&conn->user_agent, &conn->api_key, &url, NULL, &gj, "GET")) {
-        StrDeinit (&url);
+static bool ParseGetAnalysisLogs (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
 
-        StrIter j = StrIterInitFromStr (&gj);
+    Str  logs   = StrInit();
+    bool status = false;
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "status", status);
+        if (status) {
+            JR_OBJ_KV (j, "data", { JR_STR_KV (j, "logs", logs); });
+        }
+    });
 
-        Str  logs   = StrInit();
-        bool status = false;
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "status", status);
-            if (status) {
-                JR_OBJ_KV (j, "data", { JR_STR_KV (j, "logs", logs); });
-            }
-        });
+    *(Str*)out = logs;
+    return status;
+}
 
-        StrDeinit (&gj);
+Str GetAnalysisLogs (Connection* conn, AnalysisId analysis_id) {
+    ApiRequest req  = ConnectionAcquireRequest (conn);
+    Str        logs = {0};
+    Perform (
+        conn,
+        BuildGetAnalysisLogs (conn, analysis_id, &req),
+        &req,
+        ParseGetAnalysisLogs,
+        &logs
+    );
+    return logs;
+}
 
-        return logs;
-    } else {
-        return (Str) {0};
-    }
+ApiFuture* GetAnalysisLogsAsync (
+    Connection* conn,
+    AnalysisId  analysis_id,
+    Str*        logs,
+    ApiCallback callback,
+    void*       user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildGetAnalysisLogs (conn, analysis_id, &req),
+        &req,
+        ParseGetAnalysisLogs,
+        logs,
+        sizeof (*logs),
+        callback,
+        user_data
+    );
 }
 
-Str UploadFile (Connection* conn, Str file_path) {
-    if (!conn->api_key.length || !conn->host.length) {
-        LOG_ERROR ("Missing API key or host to connect to.");
-        return (Str) {0};
+static bool BuildUploadFile (Connection* conn, Str file_path, ApiRequest* req) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
     if (!file_path.length) {
         LOG_ERROR ("Invalid file path");
-        return (Str) {0};
+        return false;
     }
 
-    Str url = StrInit();
-    StrPrintf (&url, "%s/v1/upload", conn->host.data);
-
-    Str gj = StrInit();
-
-    if (MakeUploadRequest (
-            &conn->user_agent,
-            &conn->api_key,
-            &url,
-            NULL,
-            &gj,
-            "POST",
-            &file_path
-        )) {
-        StrDeinit (&url);
-
-        StrIter j = StrIterInitFromStr (&gj);
+    StrPrintf (&req->url, "%s/v1/upload", conn->host.data);
+    StrInitCopy (&req->file_path, &file_path);
+    req->method = "POST";
 
-        bool success = false;
-        Str  sha256  = StrInit();
-        JR_OBJ (j, {
-            JR_BOOL_KV (j, "success", success);
-            JR_STR_KV (j, "sha_256_hash", sha256);
-        });
-
-        StrDeinit (&gj);
-
-        return sha256;
-    } else {
-        return (Str) {0};
-    }
+    return true;
 }
 
-Str* UrlAddQueryStr (Str* url, const char* key, const char* value, bool* is_first) {
-    if (!url || !key) {
-        LOG_ERROR ("Invalid arguments.");
-        return NULL;
-    }
-
-    if (!value) {
-        LOG_INFO ("Field \"%s\" is empty. Not adding to Url query.", key);
-        return url;
-    }
+static bool ParseUploadFile (Str* json, void* out) {
+    StrIter j = StrIterInitFromStr (json);
 
-    char sep = !is_first ? '?' : *is_first ? '?' : '&';
-    StrPushBack (url, sep);
-    StrAppendf (url, "%s=%s", key, value);
+    bool success = false;
+    Str  sha256  = StrInit();
+    JR_OBJ (j, {
+        JR_BOOL_KV (j, "success", success);
+        JR_STR_KV (j, "sha_256_hash", sha256);
+    });
 
-    if (is_first) {
-        *is_first = false;
-    }
+    *(Str*)out = sha256;
+    return success;
+}
 
-    return url;
+///
+/// Upload a file, storing final stats of the upload in `stats` if it's not NULL.
+///
+static Str UploadFileWithStats (Connection* conn, Str file_path, UploadProgress* stats) {
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    Str        sha256 = {0};
+    req.upload_stats  = stats;
+    Perform (conn, BuildUploadFile (conn, file_path, &req), &req, ParseUploadFile, &sha256);
+    return sha256;
 }
 
-Str* UrlAddQueryInt (Str* url, const char* key, i64 value, bool* is_first) {
-    if (!url || !key || !value) {
-        LOG_ERROR ("Invalid arguments.");
-        return NULL;
-    }
+Str UploadFile (Connection* conn, Str file_path) {
+    return UploadFileWithStats (conn, file_path, NULL);
+}
 
-    char sep = !is_first ? '?' : *is_first ? '?' : '&';
-    StrPushBack (url, sep);
-    StrAppendf (url, "%s=%lld", key, value);
+ApiFuture* UploadFileAsync (
+    Connection* conn,
+    Str         file_path,
+    Str*        sha256,
+    ApiCallback callback,
+    void*       user_data
+) {
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildUploadFile (conn, file_path, &req),
+        &req,
+        ParseUploadFile,
+        sha256,
+        sizeof (*sha256),
+        callback,
+        user_data
+    );
+}
 
-    if (is_first) {
-        *is_first = false;
+static bool BuildUploadBuffer (
+    Connection* conn,
+    const void* data,
+    size        length,
+    const char* name,
+    ApiRequest* req
+) {
+    if (!CheckConnection (conn)) {
+        return false;
     }
 
-    return url;
-}
-
-Str* UrlAddQueryFloat (Str* url, const char* key, f64 value, bool* is_first) {
-    if (!url || !key || !value) {
+    if (!data || !length || !name || !name[0]) {
         LOG_ERROR ("Invalid arguments.");
-        return NULL;
+        return false;
     }
 
-    char sep = !is_first ? '?' : *is_first ? '?' : '&';
-    StrPushBack (url, sep);
-    StrAppendf (url, "%s=%f", key, value);
-
-    if (is_first) {
-        *is_first = false;
-    }
+    StrPrintf (&req->url, "%s/v1/upload", conn->host.data);
+    req->file_path   = StrInitFromZstr (name);
+    req->upload_data = data;
+    req->upload_size = length;
+    req->method      = "POST";
 
-    return url;
+    return true;
 }
 
-Str* UrlAddQueryBool (Str* url, const char* key, bool value, bool* is_first) {
-    return UrlAddQueryStr (url, key, value ? "true" : "false", is_first);
+///
+/// Upload a buffer, storing final stats of the upload in `stats` if it's not NULL.
+///
+static Str UploadBufferWithStats (
+    Connection*     conn,
+    const void*     data,
+    size            length,
+    const char*     name,
+    UploadProgress* stats
+) {
+    ApiRequest req    = ConnectionAcquireRequest (conn);
+    Str        sha256 = {0};
+    req.upload_stats  = stats;
+    Perform (
+        conn,
+        BuildUploadBuffer (conn, data, length, name, &req),
+        &req,
+        ParseUploadFile,
+        &sha256
+    );
+    return sha256;
 }
 
-/* libCURL */
-#include <curl/curl.h>
-
-static size CURLResponseWriteCallback (void* ptr, size sz, size nmemb, Str* raw_response) {
-    if (!ptr || !raw_response) {
-        LOG_ERROR ("Invalid arguments.");
-        return 0;
-    }
-
-    /* compute and resize buffer to required size */
-    size received_size = sz * nmemb;
-    size newlen        = raw_response->length + received_size;
-    StrPushBackCstr (raw_response, (char*)ptr, received_size);
-    return received_size;
+Str UploadBuffer (Connection* conn, const void* data, size length, const char* name) {
+    return UploadBufferWithStats (conn, data, length, name, NULL);
 }
 
-
-static bool ua_already_printed = false;
-
-bool MakeRequest (
-    Str*        user_agent,
-    Str*        api_key,
-    Str*        request_url,
-    Str*        request_json,
-    Str*        response_json,
-    const char* request_method
+ApiFuture* UploadBufferAsync (
+    Connection* conn,
+    const void* data,
+    size        length,
+    const char* name,
+    Str*        sha256,
+    ApiCallback callback,
+    void*       user_data
 ) {
-    if (!user_agent || !user_agent->length) {
-        LOG_ERROR ("Invalid user agent");
-        return false;
-    }
+    ApiRequest req = ConnectionAcquireRequest (conn);
+    return Submit (
+        conn,
+        BuildUploadBuffer (conn, data, length, name, &req),
+        &req,
+        ParseUploadFile,
+        sha256,
+        sizeof (*sha256),
+        callback,
+        user_data
+    );
+}
 
-    if (!api_key || !api_key->length) {
-        LOG_ERROR ("Invalid API key");
-        return false;
-    }
+///
+/// Check whether server already has a binary with exactly given (lowercase hex) hash.
+/// Search matches hashes by prefix, so every result is compared in full.
+///
+static bool ServerHasSha256 (Connection* conn, Str* sha256) {
+    SearchBinaryRequest search = SearchBinaryRequestInit();
+    search.page                = 1;
+    search.page_size           = 10;
+    StrInitCopy (&search.partial_sha256, sha256);
+
+    BinaryInfos infos = SearchBinary (conn, &search);
+    SearchBinaryRequestDeinit (&search);
+
+    bool found = false;
+    VecForeachPtr (&infos, info, {
+        if (found || info->sha256.length != sha256->length) {
+            continue;
+        }
 
-    if (!request_url || !request_url->length) {
-        LOG_ERROR ("Invalid request url");
-        return false;
-    }
+        found = true;
+        for (size i = 0; i < sha256->length; i++) {
+            if (tolower ((unsigned char)info->sha256.data[i]) != sha256->data[i]) {
+                found = false;
+                break;
+            }
+        }
+    });
 
-    if (!request_method) {
-        LOG_ERROR ("Invalid request method.");
-        return false;
-    }
+    VecDeinit (&infos);
+    return found;
+}
 
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        LOG_ERROR ("Failed to create a CURL handle. Cannot make requests.");
+///
+/// Check whether upload of data with given hash can be skipped, and fill report if so.
+///
+static bool
+    SkipKnownUpload (Connection* conn, const char* name, Str* sha256, UploadReport* report) {
+    if (!ServerHasSha256 (conn, sha256)) {
         return false;
     }
 
-    // use our own Str if none provided
-    Str my_json = StrInit();
-    if (!response_json) {
-        my_json       = StrInit();
-        response_json = &my_json;
-    }
-
-    // Authorization header
-    Str auth = StrInit();
-    StrPrintf (&auth, "Authorization: %s", api_key->data);
+    report->skipped     = true;
+    report->bytes_saved = report->file_size;
+    LOG_INFO (
+        "Server already has '%s' (%s), skipped uploading %llu bytes, hashing took %llu ms",
+        name,
+        sha256->data,
+        report->bytes_saved,
+        report->hash_ms
+    );
+    return true;
+}
 
-    struct curl_slist* headers = NULL;
-    headers                    = curl_slist_append (headers, auth.data);
-    StrDeinit (&auth);
+Str UploadFileIfMissing (Connection* conn, Str file_path, UploadReport* report) {
+    UploadReport my_report = {0};
+    report                 = report ? report : &my_report;
+    *report                = (UploadReport) {0};
 
-    if (request_json && request_json->length) {
-        headers = curl_slist_append (headers, "Content-Type: application/json");
-        curl_easy_setopt (curl, CURLOPT_POSTFIELDS, request_json->data);
-        LOG_INFO ("REQUEST.JSON: '%s'", request_json->data);
+    if (!CheckConnection (conn)) {
+        return StrInit();
     }
 
-    Str hdr_ua = StrInit();
-    StrPrintf (&hdr_ua, "User-Agent: %s", user_agent->data);
-    headers = curl_slist_append (headers, hdr_ua.data);
-    
-    if (!ua_already_printed) {
-        LOG_INFO ("USER_AGENT = %s", hdr_ua.data);
-        ua_already_printed = true;
+    if (!file_path.length) {
+        LOG_ERROR ("Invalid file path");
+        return StrInit();
     }
 
-    StrDeinit (&hdr_ua);
-
-    curl_easy_setopt (curl, CURLOPT_URL, request_url->data);
-    curl_easy_setopt (curl, CURLOPT_CUSTOMREQUEST, request_method);
-    curl_easy_setopt (curl, CURLOPT_HTTPHEADER, headers);
-    curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1);
-    curl_easy_setopt (curl, CURLOPT_USERAGENT, "creait");
-    curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION, CURLResponseWriteCallback);
-    curl_easy_setopt (curl, CURLOPT_WRITEDATA, response_json);
-    curl_easy_setopt (curl, CURLOPT_TIMEOUT, 30L);
-    curl_easy_setopt (curl, CURLOPT_CONNECTTIMEOUT, 10L);
-
-    // make request
-    CURLcode retcode = curl_easy_perform (curl);
-    curl_slist_free_all (headers);
-    curl_easy_cleanup (curl);
+    i64 file_size = SysGetFileSize (file_path.data);
+    if (file_size < 0) {
+        LOG_ERROR ("Failed to get size of '%s'", file_path.data);
+        return StrInit();
+    }
+    report->file_size = (u64)file_size;
 
-    // log response always!
-    LOG_INFO ("RESPONSE.JSON: '%s'", response_json->data);
+    u64  hash_start = SysGetMonotonicTimeMs();
+    Str  sha256     = StrInit();
+    bool hashed     = Sha256File (file_path.data, &sha256) != NULL;
+    report->hash_ms = SysGetMonotonicTimeMs() - hash_start;
 
-    // if we used our json, then deinit that
-    if (my_json.length) {
-        StrDeinit (&my_json);
+    if (hashed && SkipKnownUpload (conn, file_path.data, &sha256, report)) {
+        return sha256;
     }
+    StrDeinit (&sha256);
 
-    if (retcode != CURLE_OK) {
-        LOG_ERROR ("curl_easy_perform() failed: %s", curl_easy_strerror (retcode));
-        StrDeinit (response_json);
-        return false;
+    sha256 = UploadFileWithStats (conn, file_path, &report->upload);
+    if (sha256.length) {
+        report->bytes_uploaded = report->file_size;
     }
-
-    return true;
+    return sha256;
 }
 
-bool MakeUploadRequest (
-    Str*        user_agent,
-    Str*        api_key,
-    Str*        request_url,
-    Str*        request_json,
-    Str*        response_json,
-    const char* request_method,
-    Str*        file_path
+Str UploadBufferIfMissing (
+    Connection*   conn,
+    const void*   data,
+    size          length,
+    const char*   name,
+    UploadReport* report
 ) {
-    if (!user_agent || !user_agent->length) {
-        LOG_ERROR ("Invalid user agent");
-        return false;
-    }
+    UploadReport my_report = {0};
+    report                 = report ? report : &my_report;
+    *report                = (UploadReport) {0};
 
-    if (!api_key || !api_key->length) {
-        LOG_ERROR ("Invalid API key");
-        return false;
+    if (!CheckConnection (conn)) {
+        return StrInit();
     }
 
-    if (!request_url || !request_url->length) {
-        LOG_ERROR ("Invalid request url");
-        return false;
+    if (!data || !length || !name || !name[0]) {
+        LOG_ERROR ("Invalid arguments.");
+        return StrInit();
     }
+    report->file_size = length;
 
-    if (!request_method) {
-        LOG_ERROR ("Invalid request method.");
-        return false;
-    }
+    u64    hash_start = SysGetMonotonicTimeMs();
+    Sha256 ctx        = Sha256Init();
+    Str    sha256     = StrInit();
+    Sha256Update (&ctx, data, length);
+    Sha256Final (&ctx, &sha256);
+    report->hash_ms = SysGetMonotonicTimeMs() - hash_start;
 
-    if (!file_path || !file_path->length) {
-        LOG_ERROR (
-            "Invalid file path. If uploading a file is not intended, then use MakeRequest "
-            "method "
-            "instead."
-        );
-        return false;
+    if (SkipKnownUpload (conn, name, &sha256, report)) {
+        return sha256;
     }
+    StrDeinit (&sha256);
 
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        LOG_ERROR ("Failed to create a CURL handle. Cannot make requests.");
-        return false;
+    sha256 = UploadBufferWithStats (conn, data, length, name, &report->upload);
+    if (sha256.length) {
+        report->bytes_uploaded = report->file_size;
     }
+    return sha256;
+}
 
-    /* create a new mime */
-    curl_mime* mime = curl_mime_init (curl);
-    if (!mime) {
-        LOG_ERROR ("CURL failed to create mime.");
-        curl_easy_cleanup (curl);
-        return false;
+Str* UrlAddQueryStr (Str* url, const char* key, const char* value, bool* is_first) {
+    if (!url || !key) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
     }
 
-    /* create mimepart for multipart data */
-    curl_mimepart* mimepart = curl_mime_addpart (mime);
-    if (!mimepart) {
-        LOG_ERROR ("CURL failed to add mime part.");
-        curl_mime_free (mime);
-        curl_easy_cleanup (curl);
-        return false;
+    if (!value) {
+        LOG_INFO ("Field \"%s\" is empty. Not adding to Url query.", key);
+        return url;
     }
 
-    /* set part info */
-    curl_mime_name (mimepart, "file");
-    curl_mime_filedata (mimepart, file_path->data);
-
-    LOG_INFO ("UPLOAD FILE : '%s'", file_path->data);
+    char sep = !is_first ? '?' : *is_first ? '?' : '&';
+    StrPushBack (url, sep);
+    StrAppendf (url, "%s=%s", key, value);
 
-    // use our own Str if none provided
-    Str my_json = StrInit();
-    if (!response_json) {
-        my_json       = StrInit();
-        response_json = &my_json;
+    if (is_first) {
+        *is_first = false;
     }
 
-    Str auth = StrInit();
-    StrPrintf (&auth, "Authorization: %s", api_key->data);
-
-    struct curl_slist* headers = NULL;
-    headers                    = curl_slist_append (headers, auth.data);
-    StrDeinit (&auth);
+    return url;
+}
 
-    if (request_json && request_json->length) {
-        headers = curl_slist_append (headers, "Content-Type: application/json");
-        curl_easy_setopt (curl, CURLOPT_POSTFIELDS, request_json->data);
-        LOG_INFO ("REQUEST.JSON: '%s'", request_json->data);
+Str* UrlAddQueryInt (Str* url, const char* key, i64 value, bool* is_first) {
+    if (!url || !key || !value) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
     }
 
-    Str hdr_ua = StrInit();
-    StrPrintf (&hdr_ua, "User-Agent: %s", user_agent->data);
-    headers = curl_slist_append (headers, hdr_ua.data);
-    
-    if (!ua_already_printed) {
-        LOG_INFO ("USER_AGENT = %s", hdr_ua.data);
-        ua_already_printed = true;
-    }
+    char sep = !is_first ? '?' : *is_first ? '?' : '&';
+    StrPushBack (url, sep);
+    StrAppendf (url, "%s=%lld", key, value);
 
-    StrDeinit (&hdr_ua);
+    if (is_first) {
+        *is_first = false;
+    }
 
-    curl_easy_setopt (curl, CURLOPT_MIMEPOST, mime);
-    curl_easy_setopt (curl, CURLOPT_HTTPHEADER, headers);
-    curl_easy_setopt (curl, CURLOPT_URL, request_url->data);
-    curl_easy_setopt (curl, CURLOPT_CUSTOMREQUEST, request_method);
-    curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1);
-    curl_easy_setopt (curl, CURLOPT_USERAGENT, "creait");
-    curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION, CURLResponseWriteCallback);
-    curl_easy_setopt (curl, CURLOPT_WRITEDATA, response_json);
-    curl_easy_setopt (curl, CURLOPT_TIMEOUT, 30L);
-    curl_easy_setopt (curl, CURLOPT_CONNECTTIMEOUT, 10L);
+    return url;
+}
 
-    CURLcode retcode = curl_easy_perform (curl);
-    curl_slist_free_all (headers);
-    curl_mime_free (mime);
-    curl_easy_cleanup (curl);
+Str* UrlAddQueryFloat (Str* url, const char* key, f64 value, bool* is_first) {
+    if (!url || !key || !value) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
 
-    LOG_INFO ("RESPONSE.JSON: '%s'", response_json->data);
+    char sep = !is_first ? '?' : *is_first ? '?' : '&';
+    StrPushBack (url, sep);
+    StrAppendf (url, "%s=%f", key, value);
 
-    // if we used our json, then deinit that
-    if (my_json.length) {
-        StrDeinit (&my_json);
+    if (is_first) {
+        *is_first = false;
     }
 
-    if (retcode != CURLE_OK) {
-        LOG_ERROR ("curl_easy_perform() failed: %s", curl_easy_strerror (retcode));
-        StrDeinit (response_json);
-        return false;
-    }
+    return url;
+}
 
-    return true;
+Str* UrlAddQueryBool (Str* url, const char* key, bool value, bool* is_first) {
+    return UrlAddQueryStr (url, key, value ? "true" : "false", is_first);
 }
@@ -0,0 +1,1095 @@
+/**
+ * @file Async.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include <Reai/Api/Async.h>
+#include <Reai/Log.h>
+
+#include "Transport.h"
+
+#include <stdlib.h>
+
+/// Number of recent request latencies hedge delay is computed from.
+#define ENGINE_LATENCY_SAMPLES 64
+
+/// Hedge delay stays at its lower bound until this many latencies are known.
+#define ENGINE_MIN_LATENCY_SAMPLES 16
+
+typedef enum FutureState {
+    FUTURE_STATE_QUEUED,
+    FUTURE_STATE_RUNNING,
+    FUTURE_STATE_DONE
+} FutureState;
+
+struct ApiFuture {
+    AsyncEngine* engine;
+
+    // what to make
+    ApiRequest request;
+    Str        user_agent;
+    Str        api_key;
+
+    // what to do with the response
+    ApiResponseParser parser;
+    void*             out;
+    ApiContinuation   continuation;
+    void*             ctx;
+    void (*ctx_deinit) (void* ctx);
+    ApiCallback callback;
+    void*       user_data;
+
+    // owned by engine thread while running
+    CURL*         curl;
+    Transfer      xfer;
+    JsonStream    stream;
+    Str           response;
+    TransferBytes bytes;          /**< @b Summed over all requests of a chain. */
+    u64           started_at;     /**< @b When current request was started. */
+    bool          admitted;       /**< @b Holds a slot of admission control. */
+    u32           retries;        /**< @b Times a throttled request was retried. */
+    u32           upload_retries; /**< @b Times an interrupted upload was restarted. */
+    u64           retry_at;       /**< @b When a delayed request may be queued again. */
+
+    // copy of current request racing the original, owned by engine thread
+    bool     hedged; /**< @b A copy was fired (or tried to) for current request. */
+    CURL*    hedge_curl;
+    Transfer hedge_xfer;
+    Str      hedge_response;
+
+    // shared between engine thread and user
+    SysMutex*   lock;
+    SysCond*    cond;
+    FutureState state;
+    bool        succeeded;
+    bool        cancelled;
+    u32         refs;
+};
+
+typedef Vec (ApiFuture*) ApiFutures;
+
+struct AsyncEngine {
+    ConnectionPool* pool;
+    size            max_idle;
+    size            max_idle_buffers;
+    size            max_inflight;
+    u32             hedge_percentile; /**< @b 0 if hedging is disabled. */
+    u64             hedge_min_delay;
+    u64             hedge_delay; /**< @b Current hedge delay in milliseconds. */
+    u32             upload_retries;
+    Str             ca_bundle;
+    TransferOptions opts;
+    CURLM*          multi;
+    SysThread*      thread;
+
+    SysMutex*  lock;    /**< @b Guards `queued` and `stop`. */
+    ApiFutures queued;  /**< @b Submitted, but not started yet. */
+    ApiFutures running; /**< @b Touched only by engine thread. */
+    ApiFutures delayed; /**< @b Waiting to be queued again at `retry_at`. Only for engine thread. */
+    bool       stop;
+
+    // latencies of recent hedgeable requests in milliseconds, touched only by engine thread
+    u64  latencies[ENGINE_LATENCY_SAMPLES];
+    size latency_count;
+    size latency_next;
+};
+
+static AsyncEngine* EngineGet (Connection* conn);
+static void         EngineRun (void* arg);
+static ApiFuture*   EngineSubmit (AsyncEngine* engine, Connection* conn, ApiFuture* future);
+static bool         FutureStart (AsyncEngine* engine, ApiFuture* future);
+static void         FutureStop (AsyncEngine* engine, ApiFuture* future, CURLcode retcode);
+static void         FutureHedge (AsyncEngine* engine, ApiFuture* future);
+static bool         FutureSettle (AsyncEngine* engine, ApiFuture* future, CURL* curl, CURLcode res);
+static void         FutureReleaseRequest (AsyncEngine* engine, ApiFuture* future);
+static void         FutureReleaseAdmission (AsyncEngine* engine, ApiFuture* f, LimiterOutcome out);
+static void         FutureComplete (ApiFuture* future, bool succeeded);
+static void         FutureUnref (ApiFuture* future);
+static ApiFuture*   FutureCreate (ApiRequest* request);
+static bool         FutureIsCancelled (ApiFuture* future);
+static bool         FutureDeliver (ApiFuture* future);
+static ApiFuture*   FutureRunInline (Connection* conn, ApiFuture* future);
+
+ApiFuture* ConnectionSubmit (
+    Connection*       conn,
+    ApiRequest*       request,
+    ApiResponseParser parser,
+    void*             out,
+    ApiCallback       callback,
+    void*             user_data
+) {
+    if (!conn || !request) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    // backends other than libcurl have nothing for the engine to drive
+    AsyncEngine* engine = NULL;
+    if (ApiBackendIsCurl (conn->backend) && !(engine = EngineGet (conn))) {
+        return NULL;
+    }
+
+    if (conn->options) {
+        request->options = *conn->options;
+    }
+
+    ApiFuture* future = FutureCreate (request);
+    future->parser    = parser;
+    future->out       = out;
+    future->callback  = callback;
+    future->user_data = user_data;
+
+    return engine ? EngineSubmit (engine, conn, future) : FutureRunInline (conn, future);
+}
+
+ApiFuture* ConnectionSubmitChain (
+    Connection*     conn,
+    ApiRequest*     request,
+    ApiContinuation continuation,
+    void*           ctx,
+    void (*ctx_deinit) (void* ctx),
+    ApiCallback callback,
+    void*       user_data
+) {
+    if (!conn || !request || !continuation) {
+        LOG_ERROR ("Invalid arguments.");
+        if (ctx_deinit) {
+            ctx_deinit (ctx);
+        }
+        return NULL;
+    }
+
+    AsyncEngine* engine = NULL;
+    if (ApiBackendIsCurl (conn->backend) && !(engine = EngineGet (conn))) {
+        if (ctx_deinit) {
+            ctx_deinit (ctx);
+        }
+        return NULL;
+    }
+
+    if (conn->options) {
+        request->options = *conn->options;
+    }
+
+    ApiFuture* future    = FutureCreate (request);
+    future->continuation = continuation;
+    future->ctx          = ctx;
+    future->ctx_deinit   = ctx_deinit;
+    future->callback     = callback;
+    future->user_data    = user_data;
+
+    return engine ? EngineSubmit (engine, conn, future) : FutureRunInline (conn, future);
+}
+
+bool ApiFutureWait (ApiFuture* future) {
+    if (!future) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    SysMutexLock (future->lock);
+    while (future->state != FUTURE_STATE_DONE) {
+        SysCondWait (future->cond, future->lock);
+    }
+    bool succeeded = future->succeeded;
+    SysMutexUnlock (future->lock);
+
+    return succeeded;
+}
+
+TransferBytes ApiFutureGetBytes (ApiFuture* future) {
+    if (!future) {
+        LOG_ERROR ("Invalid arguments.");
+        return (TransferBytes) {0};
+    }
+
+    SysMutexLock (future->lock);
+    bool done = future->state == FUTURE_STATE_DONE;
+    SysMutexUnlock (future->lock);
+
+    // engine thread no longer touches a completed future
+    return done ? future->bytes : (TransferBytes) {0};
+}
+
+bool ApiFutureWaitFor (ApiFuture* future, u64 timeout_ms) {
+    if (!future) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    u64 deadline = SysGetMonotonicTimeMs() + timeout_ms;
+
+    SysMutexLock (future->lock);
+    while (future->state != FUTURE_STATE_DONE) {
+        u64 now = SysGetMonotonicTimeMs();
+        if (now >= deadline) {
+            break;
+        }
+        SysCondWaitTimeout (future->cond, future->lock, deadline - now);
+    }
+    bool done = future->state == FUTURE_STATE_DONE;
+    SysMutexUnlock (future->lock);
+
+    return done;
+}
+
+bool ApiFutureIsDone (ApiFuture* future) {
+    if (!future) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    SysMutexLock (future->lock);
+    bool done = future->state == FUTURE_STATE_DONE;
+    SysMutexUnlock (future->lock);
+
+    return done;
+}
+
+bool ApiFutureSucceeded (ApiFuture* future) {
+    if (!future) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    SysMutexLock (future->lock);
+    bool succeeded = future->succeeded;
+    SysMutexUnlock (future->lock);
+
+    return succeeded;
+}
+
+void ApiFutureCancel (ApiFuture* future) {
+    if (!future) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    SysMutexLock (future->lock);
+    bool pending      = future->state != FUTURE_STATE_DONE;
+    future->cancelled = true;
+    SysMutexUnlock (future->lock);
+
+    if (pending) {
+        curl_multi_wakeup (future->engine->multi);
+    }
+}
+
+void ApiFutureRelease (ApiFuture* future) {
+    if (!future) {
+        return;
+    }
+
+    FutureUnref (future);
+}
+
+///
+/// Wake engine thread up, so it retries admission of queued requests.
+///
+static void EngineWake (void* engine) {
+    curl_multi_wakeup (((AsyncEngine*)engine)->multi);
+}
+
+static AsyncEngine* EngineCreate (ConnectionPool* pool, Connection* conn) {
+    AsyncEngine* engine = NEW (AsyncEngine);
+    if (!engine) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    size max_inflight = conn->max_inflight_requests;
+
+    engine->pool             = pool;
+    engine->max_idle         = conn->max_idle_handles;
+    engine->max_idle_buffers = conn->max_idle_buffers;
+    engine->max_inflight = max_inflight ? max_inflight : CONNECTION_DEFAULT_MAX_INFLIGHT_REQUESTS;
+
+    u32 min_delay            = conn->hedge_min_delay_ms;
+    engine->hedge_percentile = conn->hedge_percentile > 99 ? 99 : conn->hedge_percentile;
+    engine->hedge_min_delay  = min_delay ? min_delay : CONNECTION_DEFAULT_HEDGE_MIN_DELAY_MS;
+    engine->hedge_delay      = engine->hedge_min_delay;
+    engine->upload_retries   = conn->upload_retries;
+    engine->lock         = SysMutexCreate();
+    engine->ca_bundle    = StrInit();
+    if (conn->ca_bundle.length) {
+        StrInitCopy (&engine->ca_bundle, &conn->ca_bundle);
+    }
+
+    engine->opts = (TransferOptions) {
+        .ca_bundle            = &engine->ca_bundle,
+        .http2                = conn->http2,
+        .compress_above       = conn->compress_requests_above,
+        .upload_chunk_size    = conn->upload_chunk_size,
+        .upload_stall_timeout = conn->upload_stall_timeout,
+        .upload_progress      = conn->upload_progress,
+        .upload_progress_data = conn->upload_progress_data,
+    };
+    engine->queued       = (ApiFutures)VecInit();
+    engine->running      = (ApiFutures)VecInit();
+    engine->delayed      = (ApiFutures)VecInit();
+
+    engine->multi = curl_multi_init();
+    if (!engine->multi) {
+        LOG_ERROR ("Failed to create CURL multi handle. Cannot make async requests.");
+        AsyncEngineDestroy (engine);
+        return NULL;
+    }
+
+    if (engine->opts.http2) {
+        size max_streams = conn->max_concurrent_streams;
+        max_streams      = max_streams ? max_streams : CONNECTION_DEFAULT_MAX_CONCURRENT_STREAMS;
+
+        curl_multi_setopt (engine->multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        curl_multi_setopt (engine->multi, CURLMOPT_MAX_CONCURRENT_STREAMS, (long)max_streams);
+    }
+
+    if (pool->limiter) {
+        LimiterSetWakeup (pool->limiter, EngineWake, engine);
+    }
+
+    engine->thread = SysThreadCreate (EngineRun, engine);
+    if (!engine->thread) {
+        LOG_ERROR ("Failed to start async request engine.");
+        AsyncEngineDestroy (engine);
+        return NULL;
+    }
+
+    return engine;
+}
+
+void AsyncEngineDestroy (AsyncEngine* engine) {
+    if (!engine) {
+        return;
+    }
+
+    if (engine->pool->limiter) {
+        LimiterSetWakeup (engine->pool->limiter, NULL, NULL);
+    }
+
+    if (engine->thread) {
+        SysMutexLock (engine->lock);
+        engine->stop = true;
+        SysMutexUnlock (engine->lock);
+
+        curl_multi_wakeup (engine->multi);
+        SysThreadJoin (engine->thread);
+        engine->thread = NULL;
+    }
+
+    // engine thread is gone, fail whatever is left
+    VecForeach (&engine->running, future, {
+        FutureStop (engine, future, CURLE_ABORTED_BY_CALLBACK);
+        FutureComplete (future, false);
+    });
+    VecForeach (&engine->queued, future, { FutureComplete (future, false); });
+    VecForeach (&engine->delayed, future, { FutureComplete (future, false); });
+
+    VecDeinit (&engine->running);
+    VecDeinit (&engine->queued);
+    VecDeinit (&engine->delayed);
+
+    if (engine->multi) {
+        curl_multi_cleanup (engine->multi);
+    }
+    SysMutexDestroy (engine->lock);
+    StrDeinit (&engine->ca_bundle);
+
+    FREE (engine);
+}
+
+static AsyncEngine* EngineGet (Connection* conn) {
+    ConnectionPool* pool   = ConnectionPoolGet (conn);
+    AsyncEngine*    engine = pool->engine;
+    if (engine) {
+        return engine;
+    }
+
+    engine = EngineCreate (pool, conn);
+    if (!engine) {
+        return NULL;
+    }
+
+    AsyncEngine* prev = SysAtomicCasPtr ((void* volatile*)&pool->engine, NULL, engine);
+    if (prev) {
+        AsyncEngineDestroy (engine);
+        return prev;
+    }
+
+    return engine;
+}
+
+static ApiFuture* EngineSubmit (AsyncEngine* engine, Connection* conn, ApiFuture* future) {
+    future->engine   = engine;
+    future->response = ConnectionPoolAcquireBuffer (engine->pool);
+    StrInitCopy (&future->user_agent, &conn->user_agent);
+    StrInitCopy (&future->api_key, &conn->api_key);
+
+    SysMutexLock (engine->lock);
+    VecPushBack (&engine->queued, future);
+    SysMutexUnlock (engine->lock);
+
+    curl_multi_wakeup (engine->multi);
+
+    return future;
+}
+
+///
+/// Remove given future from list of running futures. Order is not preserved.
+///
+static void EngineForget (AsyncEngine* engine, ApiFuture* future) {
+    VecForeachIdx (&engine->running, f, idx, {
+        if (f == future) {
+            VecDeleteFast (&engine->running, idx);
+            break;
+        }
+    });
+}
+
+///
+/// Handle a transfer that finished, either continuing the chain or completing the future.
+///
+static void EngineOnResponse (AsyncEngine* engine, ApiFuture* future, CURLcode retcode) {
+    FutureStop (engine, future, retcode);
+    bool ok = retcode == CURLE_OK && !future->xfer.failed;
+
+    if (future->request.upload_stats && future->request.file_path.length) {
+        *future->request.upload_stats = future->xfer.upload;
+    }
+
+    // throttled request wasn't processed, so send it again once admission control lets it in
+    if (future->xfer.throttled && engine->pool->limiter && future->retries < LIMITER_MAX_RETRIES) {
+        future->retries++;
+        future->response = ConnectionPoolAcquireBuffer (engine->pool);
+
+        SysMutexLock (engine->lock);
+        VecPushFront (&engine->queued, future);
+        SysMutexUnlock (engine->lock);
+        return;
+    }
+
+    // upload broke off midway, send it all again after a while
+    if (future->xfer.interrupted && future->upload_retries < engine->upload_retries) {
+        u64 wait = TransferUploadBackoff (future->upload_retries++);
+        LOG_ERROR ("Upload interrupted, restarting it in %llu ms.", wait);
+
+        future->retry_at = SysGetMonotonicTimeMs() + wait;
+        future->response = ConnectionPoolAcquireBuffer (engine->pool);
+        VecPushBack (&engine->delayed, future);
+        return;
+    }
+
+    if (future->continuation) {
+        if (!ok) {
+            FutureComplete (future, false);
+            return;
+        }
+
+        ApiRequest next = ApiRequestInit();
+        ApiStep    step = future->continuation (&future->response, &next, future->ctx);
+        if (step == API_STEP_NEXT) {
+            // every step of the chain shares budget of the call
+            next.options = future->request.options;
+            FutureReleaseRequest (engine, future);
+            future->request = next;
+            StrClear (&future->response);
+
+            // chain wants to wait a while, e.g. before polling a status again
+            if (next.delay_ms) {
+                future->retry_at = SysGetMonotonicTimeMs() + next.delay_ms;
+                VecPushBack (&engine->delayed, future);
+                return;
+            }
+
+            SysMutexLock (engine->lock);
+            VecPushBack (&engine->queued, future);
+            SysMutexUnlock (engine->lock);
+            return;
+        }
+
+        ApiRequestDeinit (&next);
+        FutureComplete (future, step == API_STEP_DONE);
+        return;
+    }
+
+    FutureComplete (future, ok && FutureDeliver (future));
+}
+
+static int CompareLatency (const void* a, const void* b) {
+    u64 x = *(const u64*)a;
+    u64 y = *(const u64*)b;
+    return (x > y) - (x < y);
+}
+
+///
+/// Record latency of a completed hedgeable request, and recompute hedge delay from
+/// configured percentile of recent latencies.
+///
+static void EngineRecordLatency (AsyncEngine* engine, u64 latency) {
+    engine->latencies[engine->latency_next] = latency;
+    engine->latency_next                    = (engine->latency_next + 1) % ENGINE_LATENCY_SAMPLES;
+    if (engine->latency_count < ENGINE_LATENCY_SAMPLES) {
+        engine->latency_count++;
+    }
+
+    if (engine->latency_count < ENGINE_MIN_LATENCY_SAMPLES) {
+        return;
+    }
+
+    u64 sorted[ENGINE_LATENCY_SAMPLES];
+    memcpy (sorted, engine->latencies, engine->latency_count * sizeof (u64));
+    qsort (sorted, engine->latency_count, sizeof (u64), CompareLatency);
+
+    u64 delay           = sorted[engine->latency_count * engine->hedge_percentile / 100];
+    engine->hedge_delay = delay > engine->hedge_min_delay ? delay : engine->hedge_min_delay;
+}
+
+///
+/// Fire copies of running requests that have been waiting for longer than hedge delay.
+///
+/// max_wait[in] : Upper bound of returned value.
+///
+/// RETURN : Milliseconds until next running request becomes due for hedging.
+///
+static u64 EngineHedge (AsyncEngine* engine, u64 max_wait) {
+    if (!engine->hedge_percentile) {
+        return max_wait;
+    }
+
+    u64 now  = SysGetMonotonicTimeMs();
+    u64 wait = max_wait;
+    VecForeach (&engine->running, f, {
+        if (f->hedged || !ApiRequestIsHedgeable (&f->request)) {
+            continue;
+        }
+
+        u64 due = f->started_at + engine->hedge_delay;
+        if (due <= now) {
+            FutureHedge (engine, f);
+        } else if (due - now < wait) {
+            wait = due - now;
+        }
+    });
+
+    return wait;
+}
+
+///
+/// Queue delayed futures again once their wait is over, or they got cancelled.
+///
+/// RETURN : Milliseconds until next delayed future is due, or runs out of time.
+///
+static u64 EngineRequeueDelayed (AsyncEngine* engine) {
+    u64 now  = SysGetMonotonicTimeMs();
+    u64 wait = LIMITER_WAIT_FOREVER;
+
+    for (size i = engine->delayed.length; i > 0; i--) {
+        ApiFuture* f = VecAt (&engine->delayed, i - 1);
+        if (f->retry_at <= now || FutureIsCancelled (f)) {
+            VecDelete (&engine->delayed, i - 1);
+
+            SysMutexLock (engine->lock);
+            VecPushFront (&engine->queued, f);
+            SysMutexUnlock (engine->lock);
+        } else {
+            // wake up for its deadline too, if that comes first
+            u64 deadline = f->request.options.deadline;
+            u64 due      = deadline && deadline < f->retry_at ? deadline : f->retry_at;
+            wait         = due - now < wait ? due - now : wait;
+        }
+    }
+
+    return wait;
+}
+
+static void EngineRun (void* arg) {
+    AsyncEngine* engine   = (AsyncEngine*)arg;
+    ApiFutures   starting = VecInit();
+    ApiFutures   failing  = VecInit();
+
+    while (true) {
+        u64 retry_wait = EngineRequeueDelayed (engine);
+
+        SysMutexLock (engine->lock);
+        if (engine->stop) {
+            SysMutexUnlock (engine->lock);
+            break;
+        }
+
+        // drop cancelled futures that haven't started yet
+        for (size i = engine->queued.length; i > 0; i--) {
+            ApiFuture* f = VecAt (&engine->queued, i - 1);
+            if (FutureIsCancelled (f)) {
+                VecPushBack (&failing, f);
+                VecDelete (&engine->queued, i - 1);
+            }
+        }
+
+        // take as many queued futures as there are free slots, and admission control lets in
+        u64 admit_wait = LIMITER_WAIT_FOREVER;
+        while (engine->queued.length && engine->running.length + starting.length < engine->max_inflight) {
+            Limiter* limiter = engine->pool->limiter;
+            if (limiter && !LimiterTryAcquire (limiter, &admit_wait)) {
+                break;
+            }
+
+            ApiFuture* f = NULL;
+            VecPopFront (&engine->queued, &f);
+            f->admitted = limiter != NULL;
+            VecPushBack (&starting, f);
+        }
+        SysMutexUnlock (engine->lock);
+
+        VecForeach (&starting, f, {
+            if (FutureStart (engine, f)) {
+                VecPushBack (&engine->running, f);
+            } else {
+                VecPushBack (&failing, f);
+            }
+        });
+        VecClear (&starting);
+
+        // abort running futures that got cancelled
+        for (size i = engine->running.length; i > 0; i--) {
+            ApiFuture* f = VecAt (&engine->running, i - 1);
+            if (FutureIsCancelled (f)) {
+                FutureStop (engine, f, CURLE_ABORTED_BY_CALLBACK);
+                VecDeleteFast (&engine->running, i - 1);
+                VecPushBack (&failing, f);
+            }
+        }
+
+        VecForeach (&failing, f, { FutureComplete (f, false); });
+        VecClear (&failing);
+
+        int      still_running = 0;
+        CURLMsg* msg           = NULL;
+        int      msgs_left     = 0;
+        bool     freed_slots   = false;
+
+        curl_multi_perform (engine->multi, &still_running);
+        while ((msg = curl_multi_info_read (engine->multi, &msgs_left))) {
+            if (msg->msg != CURLMSG_DONE) {
+                continue;
+            }
+
+            ApiFuture* f = NULL;
+            curl_easy_getinfo (msg->easy_handle, CURLINFO_PRIVATE, (char**)&f);
+            CURLcode retcode = msg->data.result;
+
+            // other copy of a hedged request may still come through
+            if (!FutureSettle (engine, f, msg->easy_handle, retcode)) {
+                continue;
+            }
+
+            EngineForget (engine, f);
+            EngineOnResponse (engine, f, retcode);
+            freed_slots = true;
+        }
+
+        u64 wait = admit_wait < retry_wait ? admit_wait : retry_wait;
+        wait     = EngineHedge (engine, wait < 1000 ? wait : 1000);
+
+        // sleeps until there's socket activity, a wakeup, or timeout,
+        // unless queued requests can take slots freed just now
+        curl_multi_poll (engine->multi, NULL, 0, freed_slots ? 0 : (int)wait, NULL);
+    }
+
+    VecDeinit (&starting);
+    VecDeinit (&failing);
+}
+
+static ApiFuture* FutureCreate (ApiRequest* request) {
+    ApiFuture* future = NEW (ApiFuture);
+    if (!future) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    // take over the request
+    future->request = *request;
+    *request        = (ApiRequest)ApiRequestInit();
+
+    future->response = StrInit();
+    future->lock     = SysMutexCreate();
+    future->cond     = SysCondCreate();
+    future->state    = FUTURE_STATE_QUEUED;
+    future->refs     = 2; // one for user, one for engine
+
+    return future;
+}
+
+static bool FutureIsCancelled (ApiFuture* future) {
+    SysMutexLock (future->lock);
+    bool cancelled = future->cancelled;
+    SysMutexUnlock (future->lock);
+
+    return cancelled || RequestOptionsExpired (&future->request.options);
+}
+
+///
+/// Hand response of a completed request to parser of the future, or to caller as is.
+///
+/// RETURN : false if parser rejected the response, true otherwise.
+///
+static bool FutureDeliver (ApiFuture* future) {
+    if (future->parser) {
+        return future->parser (&future->response, future->out);
+    }
+
+    if (future->out) {
+        StrDeinit ((Str*)future->out);
+        *(Str*)future->out = future->response;
+        future->response   = StrInit();
+    }
+    return true;
+}
+
+///
+/// Make all requests of given future over backend of the connection, on calling thread.
+/// Future has no engine, and is already done when returned.
+///
+static ApiFuture* FutureRunInline (Connection* conn, ApiFuture* future) {
+    bool ok = false;
+
+    while (true) {
+        ok = ApiBackendDispatch (conn->backend, conn, &future->request, &future->response);
+        if (!ok) {
+            // failed request leaves response deinited
+            future->response = StrInit();
+            break;
+        }
+
+        if (!future->continuation) {
+            ok = FutureDeliver (future);
+            break;
+        }
+
+        ApiRequest next = ApiRequestInit();
+        ApiStep    step = future->continuation (&future->response, &next, future->ctx);
+        if (step != API_STEP_NEXT) {
+            ApiRequestDeinit (&next);
+            ok = step == API_STEP_DONE;
+            break;
+        }
+
+        // every step of the chain shares budget of the call
+        next.options = future->request.options;
+        ApiRequestDeinit (&future->request);
+        future->request = next;
+        StrClear (&future->response);
+
+        // nothing else to do on this thread meanwhile, so just wait, unless call expires
+        u64 until = SysGetMonotonicTimeMs() + next.delay_ms;
+        for (u64 now = SysGetMonotonicTimeMs(); now < until && !FutureIsCancelled (future);
+             now     = SysGetMonotonicTimeMs()) {
+            SysSleepMs (MIN2 (until - now, 50));
+        }
+    }
+
+    FutureComplete (future, ok);
+    return future;
+}
+
+static bool FutureStart (AsyncEngine* engine, ApiFuture* future) {
+    future->started_at = SysGetMonotonicTimeMs();
+    future->hedged     = false;
+
+    if (FutureIsCancelled (future)) {
+        return false;
+    }
+
+    future->curl = ConnectionPoolAcquire (engine->pool);
+    if (!future->curl) {
+        return false;
+    }
+
+    ApiRequest* req = &future->request;
+    future->stream  = (JsonStream)JsonStreamInit (req->stream_key, req->stream_reader, req->stream_ctx);
+
+    if (!TransferSetup (
+            &future->xfer,
+            future->curl,
+            &future->user_agent,
+            &future->api_key,
+            &future->request.url,
+            &future->request.body,
+            &future->response,
+            future->request.method,
+            future->request.file_path.length ? &future->request.file_path : NULL,
+            req->upload_data,
+            req->upload_size,
+            req->stream_key ? &future->stream : NULL,
+            &req->options,
+            &engine->opts
+        )) {
+        ConnectionPoolRelease (engine->pool, future->curl, engine->max_idle, NULL);
+        JsonStreamDeinit (&future->stream);
+        future->curl = NULL;
+        return false;
+    }
+
+    future->xfer.upload.retries = future->upload_retries;
+
+    curl_easy_setopt (future->curl, CURLOPT_PRIVATE, future);
+    if (curl_multi_add_handle (engine->multi, future->curl) != CURLM_OK) {
+        LOG_ERROR ("Failed to add request to async engine.");
+        FutureStop (engine, future, CURLE_FAILED_INIT);
+        return false;
+    }
+
+    SysMutexLock (future->lock);
+    future->state = FUTURE_STATE_RUNNING;
+    SysMutexUnlock (future->lock);
+
+    return true;
+}
+
+///
+/// Detach one transfer of a future (original or hedged copy) and give its handle back to pool.
+///
+static void AttemptStop (
+    AsyncEngine* engine,
+    ApiFuture*   future,
+    CURL**       curl,
+    Transfer*    xfer,
+    CURLcode     retcode
+) {
+    if (!*curl) {
+        return;
+    }
+
+    curl_multi_remove_handle (engine->multi, *curl);
+    TransferFinish (xfer, retcode);
+    ConnectionPoolRelease (engine->pool, *curl, engine->max_idle, xfer);
+
+    future->bytes.sent_wire        += xfer->bytes.sent_wire;
+    future->bytes.sent_decoded     += xfer->bytes.sent_decoded;
+    future->bytes.received_wire    += xfer->bytes.received_wire;
+    future->bytes.received_decoded += xfer->bytes.received_decoded;
+    *curl = NULL;
+}
+
+///
+/// Cancel hedged copy of current request, if there's one running. It's not counted in stats.
+///
+static void FutureAbandonHedge (AsyncEngine* engine, ApiFuture* future) {
+    if (!future->hedge_curl) {
+        return;
+    }
+
+    future->hedge_xfer.abandoned = true;
+    CURLcode aborted             = CURLE_ABORTED_BY_CALLBACK;
+    AttemptStop (engine, future, &future->hedge_curl, &future->hedge_xfer, aborted);
+    StrDeinit (&future->hedge_response);
+}
+
+///
+/// Detach handles of a running future and give them back to the pool.
+///
+static void FutureStop (AsyncEngine* engine, ApiFuture* future, CURLcode retcode) {
+    FutureAbandonHedge (engine, future);
+    if (future->curl) {
+        AttemptStop (engine, future, &future->curl, &future->xfer, retcode);
+        JsonStreamDeinit (&future->stream);
+    }
+
+    FutureReleaseAdmission (engine, future, TransferOutcome (&future->xfer));
+}
+
+///
+/// Give slot of admission control held by the future back, reporting how its request went.
+///
+static void
+    FutureReleaseAdmission (AsyncEngine* engine, ApiFuture* future, LimiterOutcome outcome) {
+    if (!future->admitted) {
+        return;
+    }
+
+    future->admitted = false;
+    LimiterRelease (
+        engine->pool->limiter,
+        outcome,
+        SysGetMonotonicTimeMs() - future->started_at,
+        future->xfer.retry_after
+    );
+}
+
+///
+/// Fire a copy of current request of given future, to race the original one.
+/// At most one copy is fired per request, even if it fails to start.
+///
+static void FutureHedge (AsyncEngine* engine, ApiFuture* future) {
+    future->hedged = true;
+
+    CURL* curl = ConnectionPoolAcquire (engine->pool);
+    if (!curl) {
+        return;
+    }
+
+    future->hedge_response = ConnectionPoolAcquireBuffer (engine->pool);
+    if (!TransferSetup (
+            &future->hedge_xfer,
+            curl,
+            &future->user_agent,
+            &future->api_key,
+            &future->request.url,
+            &future->request.body,
+            &future->hedge_response,
+            future->request.method,
+            NULL,
+            NULL,
+            0,
+            NULL,
+            &future->request.options,
+            &engine->opts
+        )) {
+        ConnectionPoolRelease (engine->pool, curl, engine->max_idle, NULL);
+        ConnectionPoolReleaseBuffer (
+            engine->pool,
+            engine->max_idle_buffers,
+            &future->hedge_response
+        );
+        return;
+    }
+
+    curl_easy_setopt (curl, CURLOPT_PRIVATE, future);
+    if (curl_multi_add_handle (engine->multi, curl) != CURLM_OK) {
+        LOG_ERROR ("Failed to add hedged request to async engine.");
+        TransferFinish (&future->hedge_xfer, CURLE_FAILED_INIT);
+        ConnectionPoolRelease (engine->pool, curl, engine->max_idle, &future->hedge_xfer);
+        return;
+    }
+    future->hedge_curl = curl;
+
+    SysMutexLock (engine->pool->lock);
+    engine->pool->stats.hedged_requests++;
+    SysMutexUnlock (engine->pool->lock);
+}
+
+///
+/// Move finished hedged copy into place of the original request, which must be stopped already.
+///
+static void FuturePromoteHedge (ApiFuture* future) {
+    Str lost               = future->response;
+    future->response       = future->hedge_response;
+    future->hedge_response = lost;
+
+    // transfer is complete, nothing refers to its old location anymore
+    future->xfer          = future->hedge_xfer;
+    future->xfer.response = &future->response;
+    future->curl          = future->hedge_curl;
+    future->hedge_curl    = NULL;
+}
+
+///
+/// Decide outcome of a future, one of whose transfers just finished on given handle.
+/// When a hedged copy is racing the original, first one to succeed wins and the other
+/// one is cancelled. Winner is always left in place of the original request.
+///
+/// RETURN : true if future has a result, false if it still waits for the other transfer.
+///
+static bool FutureSettle (AsyncEngine* engine, ApiFuture* future, CURL* curl, CURLcode retcode) {
+    bool hedgeable = engine->hedge_percentile && ApiRequestIsHedgeable (&future->request);
+    if (hedgeable && retcode == CURLE_OK) {
+        EngineRecordLatency (engine, SysGetMonotonicTimeMs() - future->started_at);
+    }
+
+    if (!future->hedge_curl) {
+        return true;
+    }
+
+    if (curl != future->hedge_curl) {
+        if (retcode == CURLE_OK) {
+            FutureAbandonHedge (engine, future);
+            return true;
+        }
+
+        // copy may still succeed
+        AttemptStop (engine, future, &future->curl, &future->xfer, retcode);
+        return false;
+    }
+
+    if (future->curl) {
+        if (retcode != CURLE_OK) {
+            // original may still succeed
+            AttemptStop (engine, future, &future->hedge_curl, &future->hedge_xfer, retcode);
+            return false;
+        }
+
+        future->xfer.abandoned = true;
+        AttemptStop (engine, future, &future->curl, &future->xfer, CURLE_ABORTED_BY_CALLBACK);
+    }
+
+    if (retcode == CURLE_OK) {
+        SysMutexLock (engine->pool->lock);
+        engine->pool->stats.hedge_wins++;
+        SysMutexUnlock (engine->pool->lock);
+    }
+
+    FuturePromoteHedge (future);
+    return true;
+}
+
+///
+/// Give buffers of current request of the future back to the pool, for next requests to reuse.
+///
+static void FutureReleaseRequest (AsyncEngine* engine, ApiFuture* future) {
+    ApiRequest* req = &future->request;
+    ConnectionPoolReleaseBuffer (engine->pool, engine->max_idle_buffers, &req->url);
+    ConnectionPoolReleaseBuffer (engine->pool, engine->max_idle_buffers, &req->body);
+    ApiRequestDeinit (req);
+}
+
+static void FutureComplete (ApiFuture* future, bool succeeded) {
+    if (future->ctx_deinit) {
+        future->ctx_deinit (future->ctx);
+        future->ctx_deinit = NULL;
+    }
+    future->ctx = NULL;
+
+    // futures run inline have no engine, and nothing to give back to it
+    if (future->engine) {
+        FutureReleaseAdmission (future->engine, future, LIMITER_OUTCOME_FAILURE);
+        FutureReleaseRequest (future->engine, future);
+        ConnectionPoolReleaseBuffer (
+            future->engine->pool,
+            future->engine->max_idle_buffers,
+            &future->response
+        );
+    }
+
+    SysMutexLock (future->lock);
+    future->succeeded = succeeded;
+    SysMutexUnlock (future->lock);
+
+    if (future->callback) {
+        future->callback (future, future->user_data);
+    }
+
+    SysMutexLock (future->lock);
+    future->state = FUTURE_STATE_DONE;
+    SysCondBroadcast (future->cond);
+    SysMutexUnlock (future->lock);
+
+    FutureUnref (future);
+}
+
+static void FutureUnref (ApiFuture* future) {
+    SysMutexLock (future->lock);
+    bool last = !--future->refs;
+    SysMutexUnlock (future->lock);
+
+    if (!last) {
+        return;
+    }
+
+    ApiRequestDeinit (&future->request);
+    StrDeinit (&future->response);
+    StrDeinit (&future->hedge_response);
+    StrDeinit (&future->user_agent);
+    StrDeinit (&future->api_key);
+    SysCondDestroy (future->cond);
+    SysMutexDestroy (future->lock);
+
+    FREE (future);
+}
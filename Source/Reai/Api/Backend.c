@@ -0,0 +1,468 @@
+/**
+ * @file Backend.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include <Reai/Api/Backend.h>
+#include <Reai/File.h>
+#include <Reai/Log.h>
+
+#include "Transport.h"
+
+// libc
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+///
+/// First line of every recording. Each record that follows is a header line
+///
+///     <method> <path length> <body length> <name length> <ok> <response length>
+///
+/// followed by that many bytes of path, body, uploaded file name and response,
+/// and a newline. Lengths make the format binary safe, no escaping is needed.
+///
+#define RECORDING_MAGIC "creait-recording 1\n"
+
+/* --------------------------------------- libcurl ----------------------------------------- */
+
+static bool
+    CurlPerform (ApiBackend* backend, Connection* conn, ApiRequest* request, Str* response) {
+    (void)backend;
+    return ConnectionPerformCurl (conn, request, response);
+}
+
+static ApiBackend curl_backend = {
+    .name    = "libcurl",
+    .perform = CurlPerform,
+    .upload  = CurlPerform,
+    .destroy = NULL,
+};
+
+ApiBackend* ApiBackendCurl() {
+    return &curl_backend;
+}
+
+bool ApiBackendIsCurl (ApiBackend* backend) {
+    return !backend || backend == &curl_backend;
+}
+
+bool ApiBackendDispatch (
+    ApiBackend* backend,
+    Connection* conn,
+    ApiRequest* request,
+    Str*        response
+) {
+    if (RequestOptionsExpired (&request->options)) {
+        LOG_ERROR ("Request aborted, call got cancelled or ran out of time.");
+        if (response) {
+            StrDeinit (response);
+        }
+        return false;
+    }
+
+    // backends always produce complete body, streamed array is split out of it here
+    ApiRequest view    = *request;
+    view.stream_key    = NULL;
+    view.stream_reader = NULL;
+    view.stream_ctx    = NULL;
+
+    Str  body   = StrInit();
+    bool upload = request->file_path.length || request->upload_data;
+    bool res    = upload ? backend->upload (backend, conn, &view, &body) :
+                           backend->perform (backend, conn, &view, &body);
+
+    if (res && request->stream_key) {
+        JsonStream stream =
+            JsonStreamInit (request->stream_key, request->stream_reader, request->stream_ctx);
+        Str envelope = StrInit();
+        res          = JsonStreamFeed (&stream, body.data, body.length) &&
+              JsonStreamFinish (&stream, &envelope);
+        JsonStreamDeinit (&stream);
+        StrDeinit (&body);
+        body = envelope;
+    }
+
+    if (res && response) {
+        StrMerge (response, &body);
+    } else if (response) {
+        StrDeinit (response);
+    }
+    StrDeinit (&body);
+
+    if (!res) {
+        LOG_ERROR (
+            "Request %s '%s' failed on %s backend.",
+            request->method,
+            request->url.data,
+            backend->name
+        );
+    }
+    return res;
+}
+
+/* --------------------------------------- handler ----------------------------------------- */
+
+typedef struct HandlerBackend {
+    ApiBackend base;
+    ApiHandler handler;
+    void*      ctx;
+} HandlerBackend;
+
+static bool
+    HandlerPerform (ApiBackend* backend, Connection* conn, ApiRequest* request, Str* response) {
+    (void)conn;
+    HandlerBackend* self = (HandlerBackend*)backend;
+    return self->handler (self->ctx, request, response);
+}
+
+static void HandlerDestroy (ApiBackend* backend) {
+    FREE (backend);
+}
+
+ApiBackend* ApiBackendCreateHandler (ApiHandler handler, void* ctx) {
+    if (!handler) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    HandlerBackend* self = NEW (HandlerBackend);
+    if (!self) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    self->base.name    = "handler";
+    self->base.perform = HandlerPerform;
+    self->base.upload  = HandlerPerform;
+    self->base.destroy = HandlerDestroy;
+    self->handler      = handler;
+    self->ctx          = ctx;
+
+    return &self->base;
+}
+
+/* ------------------------------------ record/replay -------------------------------------- */
+
+///
+/// Part of a request or response being recorded, or pointing into a loaded recording.
+///
+typedef struct RecordField {
+    const char* data;
+    size        length;
+} RecordField;
+
+///
+/// Get parts identifying given request : method, URL with host stripped, body, uploaded file name.
+///
+static void RequestKey (Connection* conn, ApiRequest* request, RecordField key[4]) {
+    key[0] = (RecordField) {request->method, strlen (request->method)};
+    key[1] = (RecordField) {request->url.data, request->url.length};
+    key[2] = (RecordField) {request->body.data, request->body.length};
+    key[3] = (RecordField) {"", 0};
+
+    if (conn->host.length && StrStartsWith (&request->url, &conn->host)) {
+        key[1].data   += conn->host.length;
+        key[1].length -= conn->host.length;
+    }
+
+    if (request->file_path.length) {
+        key[3].data   = FileBaseName (&request->file_path);
+        key[3].length = strlen (key[3].data);
+    }
+}
+
+typedef struct RecorderBackend {
+    ApiBackend  base;
+    ApiBackend* inner;
+    SysMutex*   lock; /**< @b Keeps records written from different threads apart. */
+    FILE*       file;
+} RecorderBackend;
+
+static bool RecorderForward (
+    RecorderBackend* self,
+    Connection*      conn,
+    ApiRequest*      request,
+    Str*             response,
+    bool             upload
+) {
+    bool res = upload ? self->inner->upload (self->inner, conn, request, response) :
+                        self->inner->perform (self->inner, conn, request, response);
+
+    // failed request may leave response deinited, it's recorded empty
+    if (!res) {
+        StrDeinit (response);
+        *response = StrInit();
+    }
+
+    RecordField key[4];
+    RequestKey (conn, request, key);
+
+    SysMutexLock (self->lock);
+    fprintf (
+        self->file,
+        "%.*s %zu %zu %zu %d %zu\n",
+        (int)key[0].length,
+        key[0].data,
+        key[1].length,
+        key[2].length,
+        key[3].length,
+        res ? 1 : 0,
+        response->length
+    );
+    for (size i = 1; i < 4; i++) {
+        if (key[i].length) {
+            fwrite (key[i].data, 1, key[i].length, self->file);
+        }
+    }
+    if (response->length) {
+        fwrite (response->data, 1, response->length, self->file);
+    }
+    fputc ('\n', self->file);
+    fflush (self->file);
+    SysMutexUnlock (self->lock);
+
+    return res;
+}
+
+static bool
+    RecorderPerform (ApiBackend* backend, Connection* conn, ApiRequest* request, Str* response) {
+    return RecorderForward ((RecorderBackend*)backend, conn, request, response, false);
+}
+
+static bool
+    RecorderUpload (ApiBackend* backend, Connection* conn, ApiRequest* request, Str* response) {
+    return RecorderForward ((RecorderBackend*)backend, conn, request, response, true);
+}
+
+static void RecorderDestroy (ApiBackend* backend) {
+    RecorderBackend* self = (RecorderBackend*)backend;
+    fclose (self->file);
+    SysMutexDestroy (self->lock);
+    FREE (self);
+}
+
+ApiBackend* ApiBackendCreateRecorder (const char* path, ApiBackend* inner) {
+    if (!path) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    FILE* file = fopen (path, "wb");
+    if (!file) {
+        Str syserr;
+        StrInitStack (&syserr, SYS_ERROR_STR_MAX_LENGTH, {
+            LOG_ERROR ("fopen() failed : %s.", SysStrError (errno, &syserr)->data);
+        });
+        return NULL;
+    }
+    fputs (RECORDING_MAGIC, file);
+
+    RecorderBackend* self = NEW (RecorderBackend);
+    if (!self) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    self->base.name    = "recorder";
+    self->base.perform = RecorderPerform;
+    self->base.upload  = RecorderUpload;
+    self->base.destroy = RecorderDestroy;
+    self->inner        = inner ? inner : ApiBackendCurl();
+    self->lock         = SysMutexCreate();
+    self->file         = file;
+
+    return &self->base;
+}
+
+typedef struct Record {
+    RecordField key[4];
+    RecordField response;
+    bool        ok;
+    bool        used; /**< @b Already played back in current round. */
+} Record;
+
+typedef Vec (Record) Records;
+
+typedef struct ReplayerBackend {
+    ApiBackend base;
+    SysMutex*  lock; /**< @b Guards `used` flags of records. */
+    Str        recording;
+    Records    records; /**< @b Point into `recording`. */
+} ReplayerBackend;
+
+static bool RecordMatches (Record* record, RecordField key[4]) {
+    for (size i = 0; i < 4; i++) {
+        if (record->key[i].length != key[i].length ||
+            (key[i].length && memcmp (record->key[i].data, key[i].data, key[i].length))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+///
+/// Take next recorded response for given request. Lock must be held.
+///
+static Record* ReplayerNext (ReplayerBackend* self, RecordField key[4]) {
+    Record* first = NULL;
+    VecForeachPtr (&self->records, record, {
+        if (!RecordMatches (record, key)) {
+            continue;
+        }
+        if (!record->used) {
+            record->used = true;
+            return record;
+        }
+        first = first ? first : record;
+    });
+
+    if (!first) {
+        return NULL;
+    }
+
+    // every response to this request has been played, start over
+    VecForeachPtr (&self->records, record, {
+        if (RecordMatches (record, key)) {
+            record->used = false;
+        }
+    });
+    first->used = true;
+    return first;
+}
+
+static bool
+    ReplayerPerform (ApiBackend* backend, Connection* conn, ApiRequest* request, Str* response) {
+    ReplayerBackend* self = (ReplayerBackend*)backend;
+
+    RecordField key[4];
+    RequestKey (conn, request, key);
+
+    SysMutexLock (self->lock);
+    Record* record = ReplayerNext (self, key);
+    SysMutexUnlock (self->lock);
+
+    if (!record) {
+        LOG_ERROR (
+            "No recorded response for %s '%.*s'.",
+            request->method,
+            (int)key[1].length,
+            key[1].data
+        );
+        return false;
+    }
+
+    StrPushBackCstr (response, record->response.data, record->response.length);
+    return record->ok;
+}
+
+///
+/// Split loaded recording into records.
+///
+/// SUCCESS : true
+/// FAILURE : false if recording is malformed.
+///
+static bool ReplayerParse (ReplayerBackend* self) {
+    const char* p   = self->recording.data;
+    const char* end = p + self->recording.length;
+
+    size magic_length = strlen (RECORDING_MAGIC);
+    if (self->recording.length < magic_length || memcmp (p, RECORDING_MAGIC, magic_length)) {
+        LOG_ERROR ("Not a recording.");
+        return false;
+    }
+    p += magic_length;
+
+    while (p < end) {
+        const char* eol    = memchr (p, '\n', end - p);
+        const char* method = p;
+        const char* space  = eol ? memchr (p, ' ', eol - p) : NULL;
+        if (!space) {
+            LOG_ERROR ("Malformed record header.");
+            return false;
+        }
+
+        Record record = {0};
+        record.key[0] = (RecordField) {method, space - method};
+
+        u64   lengths[5];
+        char* num = (char*)space;
+        for (size i = 0; i < 5; i++) {
+            lengths[i] = strtoull (num, &num, 10);
+            if (num > eol) {
+                LOG_ERROR ("Malformed record header.");
+                return false;
+            }
+        }
+
+        p             = eol + 1;
+        u64 remaining = end - p;
+        u64 needed    = lengths[0] + lengths[1] + lengths[2] + lengths[4] + 1;
+        if (needed > remaining || p[needed - 1] != '\n') {
+            LOG_ERROR ("Truncated record.");
+            return false;
+        }
+
+        record.key[1]   = (RecordField) {p, lengths[0]};
+        record.key[2]   = (RecordField) {p + lengths[0], lengths[1]};
+        record.key[3]   = (RecordField) {p + lengths[0] + lengths[1], lengths[2]};
+        record.ok       = lengths[3];
+        record.response = (RecordField) {p + lengths[0] + lengths[1] + lengths[2], lengths[4]};
+        VecPushBack (&self->records, record);
+
+        p += needed;
+    }
+
+    return true;
+}
+
+static void ReplayerDestroy (ApiBackend* backend) {
+    ReplayerBackend* self = (ReplayerBackend*)backend;
+    VecDeinit (&self->records);
+    StrDeinit (&self->recording);
+    SysMutexDestroy (self->lock);
+    FREE (self);
+}
+
+ApiBackend* ApiBackendCreateReplayer (const char* path) {
+    if (!path) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    Str recording = StrInit();
+    if (!ReadCompleteFile (path, &recording.data, &recording.length, &recording.capacity)) {
+        LOG_ERROR ("Failed to read recording '%s'.", path);
+        StrDeinit (&recording);
+        return NULL;
+    }
+
+    ReplayerBackend* self = NEW (ReplayerBackend);
+    if (!self) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    self->base.name    = "replayer";
+    self->base.perform = ReplayerPerform;
+    self->base.upload  = ReplayerPerform;
+    self->base.destroy = ReplayerDestroy;
+    self->lock         = SysMutexCreate();
+    self->recording    = recording;
+    self->records      = (Records)VecInit();
+
+    if (!ReplayerParse (self)) {
+        LOG_ERROR ("Failed to load recording '%s'.", path);
+        ReplayerDestroy (&self->base);
+        return NULL;
+    }
+
+    return &self->base;
+}
+
+void ApiBackendDestroy (ApiBackend* backend) {
+    if (ApiBackendIsCurl (backend) || !backend->destroy) {
+        return;
+    }
+
+    backend->destroy (backend);
+}
@@ -0,0 +1,1575 @@
+/**
+ * @file Connection.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include <Reai/Api/Async.h>
+#include <Reai/Api/Connection.h>
+#include <Reai/Log.h>
+
+#include "Transport.h"
+
+#include <ctype.h>
+#include <errno.h>
+
+#ifdef REAI_HAVE_OPENSSL
+#    include <openssl/ssl.h>
+#endif
+
+#ifdef REAI_HAVE_ZLIB
+#    include <zlib.h>
+#endif
+
+static bool       PerformRequest (Connection* conn, ApiRequest* request, Str* response_json);
+static bool       PerformThroughEngine (Connection* conn, ApiRequest* request, Str* response_json);
+static ApiRequest ShallowRequest (
+    Str*        request_url,
+    Str*        request_json,
+    const char* request_method,
+    Str*        file_path
+);
+
+void ConnectionDeinit (Connection* conn) {
+    if (!conn) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    ConnectionPoolDestroy (conn->pool);
+    conn->pool = NULL;
+
+    StrDeinit (&conn->user_agent);
+    StrDeinit (&conn->host);
+    StrDeinit (&conn->api_key);
+    StrDeinit (&conn->ca_bundle);
+}
+
+struct CancelToken {
+    SysMutex* lock;
+    bool      cancelled;
+};
+
+Connection ConnectionWithOptions (Connection* conn, const RequestOptions* options) {
+    if (!conn) {
+        LOG_ERROR ("Invalid arguments.");
+        return (Connection) {0};
+    }
+
+    // view must share pool with the connection, not create one of its own
+    ConnectionPoolGet (conn);
+
+    Connection view = *conn;
+    view.options    = options;
+    return view;
+}
+
+bool RequestOptionsExpired (const RequestOptions* options) {
+    if (!options) {
+        return false;
+    }
+
+    if (options->cancel && CancelTokenIsCancelled (options->cancel)) {
+        return true;
+    }
+
+    return options->deadline && SysGetMonotonicTimeMs() >= options->deadline;
+}
+
+CancelToken* CancelTokenCreate() {
+    CancelToken* token = NEW (CancelToken);
+    if (!token) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    token->lock = SysMutexCreate();
+    return token;
+}
+
+void CancelTokenDestroy (CancelToken* token) {
+    if (!token) {
+        return;
+    }
+
+    SysMutexDestroy (token->lock);
+    FREE (token);
+}
+
+void CancelTokenCancel (CancelToken* token) {
+    if (!token) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    SysMutexLock (token->lock);
+    token->cancelled = true;
+    SysMutexUnlock (token->lock);
+}
+
+bool CancelTokenIsCancelled (CancelToken* token) {
+    if (!token) {
+        return false;
+    }
+
+    SysMutexLock (token->lock);
+    bool cancelled = token->cancelled;
+    SysMutexUnlock (token->lock);
+
+    return cancelled;
+}
+
+ConnectionStats ConnectionGetStats (Connection* conn) {
+    if (!conn) {
+        LOG_ERROR ("Invalid arguments.");
+        return (ConnectionStats) {0};
+    }
+
+    ConnectionPool* pool = conn->pool;
+    if (!pool) {
+        return (ConnectionStats) {0};
+    }
+
+    SysMutexLock (pool->lock);
+    ConnectionStats stats = pool->stats;
+    SysMutexUnlock (pool->lock);
+
+    if (pool->limiter) {
+        stats.concurrency_limit = LimiterGetLimit (pool->limiter);
+    }
+
+    return stats;
+}
+
+///
+/// A warm-up request, made on a thread of its own.
+///
+typedef struct Warmup {
+    Transfer   xfer;
+    CURLcode   result;
+    u64        latency; /**< @b Milliseconds request took, reported to admission control. */
+    SysThread* thread;
+} Warmup;
+
+static void WarmupRun (void* arg) {
+    Warmup* warmup  = (Warmup*)arg;
+    u64     started = SysGetMonotonicTimeMs();
+    warmup->result  = curl_easy_perform (warmup->xfer.curl);
+    warmup->latency = SysGetMonotonicTimeMs() - started;
+}
+
+bool ConnectionWarmup (Connection* conn, size connections) {
+    if (!conn || !conn->host.length) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    // requests never leave the process, there's nothing to connect to
+    if (!ApiBackendIsCurl (conn->backend)) {
+        return true;
+    }
+
+    // pool would close connections beyond those its idle handles keep right away
+    size max_idle = conn->max_idle_handles ? conn->max_idle_handles :
+                                             CONNECTION_DEFAULT_MAX_IDLE_HANDLES;
+    connections   = conn->http2 ? MIN2 (connections, 1) : connections;
+    connections   = MIN2 (connections, MIN2 (max_idle, CONNECTION_MAX_WARMUP_CONNECTIONS));
+    if (!connections) {
+        return true;
+    }
+
+    ConnectionPool* pool = ConnectionPoolGet (conn);
+    RequestOptions  call = conn->options ? *conn->options : (RequestOptions)RequestOptionsInit();
+
+    Str url  = StrInit();
+    Str body = StrInit();
+    StrPrintf (&url, "%s/v1/authenticate", conn->host.data);
+
+    // every request goes through async engine, over the one connection it keeps open
+    if (conn->http2) {
+        ApiRequest request = ShallowRequest (&url, NULL, "GET", NULL);
+        request.options    = call;
+        bool opened        = PerformThroughEngine (conn, &request, NULL);
+        StrDeinit (&url);
+        if (!opened) {
+            LOG_ERROR ("Failed to open connection to host.");
+        }
+        return opened;
+    }
+
+    // a pooled handle keeps connection it opened to itself, so each one is warmed up
+    // on a thread of its own, all at once, so that each of them needs a new connection
+    TransferOptions opts                                       = {.ca_bundle = &conn->ca_bundle};
+    Warmup          warmups[CONNECTION_MAX_WARMUP_CONNECTIONS] = {0};
+    size            started                                    = 0;
+    while (started < connections) {
+        Warmup*   warmup = &warmups[started];
+        Transfer* xfer   = &warmup->xfer;
+
+        // each one takes a token like any request, and none waits for one
+        u64 wait = 0;
+        if (pool->limiter && !LimiterTryAcquire (pool->limiter, &wait)) {
+            LOG_INFO ("Admission control lets only %zu warm-up requests in now.", (size_t)started);
+            break;
+        }
+
+        CURL* curl = ConnectionPoolAcquire (pool);
+        if (!curl) {
+            if (pool->limiter) {
+                LimiterRelease (pool->limiter, LIMITER_OUTCOME_FAILURE, 0, 0);
+            }
+            break;
+        }
+
+        if (!TransferSetup (
+                xfer,
+                curl,
+                &conn->user_agent,
+                &conn->api_key,
+                &url,
+                &body,
+                NULL,
+                "GET",
+                NULL,
+                NULL,
+                0,
+                NULL,
+                &call,
+                &opts
+            )) {
+            ConnectionPoolRelease (pool, curl, conn->max_idle_handles, NULL);
+            if (pool->limiter) {
+                LimiterRelease (pool->limiter, LIMITER_OUTCOME_FAILURE, 0, 0);
+            }
+            break;
+        }
+
+        warmup->thread = SysThreadCreate (WarmupRun, warmup);
+        started++;
+    }
+
+    for (size i = 0; i < started; i++) {
+        if (warmups[i].thread) {
+            SysThreadJoin (warmups[i].thread);
+        } else {
+            // no thread for it, warm it up here instead
+            WarmupRun (&warmups[i]);
+        }
+    }
+
+    // handles are released only after all are done, so none picked up another's connection
+    size opened = 0;
+    for (size i = 0; i < started; i++) {
+        Transfer* xfer  = &warmups[i].xfer;
+        opened         += TransferFinish (xfer, warmups[i].result);
+        if (pool->limiter) {
+            LimiterRelease (
+                pool->limiter,
+                TransferOutcome (xfer),
+                warmups[i].latency,
+                xfer->retry_after
+            );
+        }
+        ConnectionPoolRelease (pool, xfer->curl, conn->max_idle_handles, xfer);
+    }
+
+    StrDeinit (&url);
+    StrDeinit (&body);
+
+    if (opened < connections) {
+        LOG_ERROR (
+            "Opened only %zu of %zu connections to host.",
+            (size_t)opened,
+            (size_t)connections
+        );
+        return false;
+    }
+    return true;
+}
+
+void ApiRequestDeinit (ApiRequest* req) {
+    if (!req) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    StrDeinit (&req->url);
+    StrDeinit (&req->body);
+    StrDeinit (&req->file_path);
+    req->method        = NULL;
+    req->stream_key    = NULL;
+    req->stream_reader = NULL;
+    req->stream_ctx    = NULL;
+    req->upload_stats  = NULL;
+    req->upload_data   = NULL;
+    req->upload_size   = 0;
+}
+
+Str ConnectionAcquireBuffer (Connection* conn) {
+    if (!conn) {
+        return StrInit();
+    }
+
+    return ConnectionPoolAcquireBuffer (ConnectionPoolGet (conn));
+}
+
+void ConnectionReleaseBuffer (Connection* conn, Str* buf) {
+    if (!buf) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    if (!conn) {
+        StrDeinit (buf);
+        return;
+    }
+
+    ConnectionPoolReleaseBuffer (ConnectionPoolGet (conn), conn->max_idle_buffers, buf);
+}
+
+ApiRequest ConnectionAcquireRequest (Connection* conn) {
+    ApiRequest req = ApiRequestInit();
+    req.url        = ConnectionAcquireBuffer (conn);
+    req.body       = ConnectionAcquireBuffer (conn);
+    return req;
+}
+
+void ConnectionReleaseRequest (Connection* conn, ApiRequest* req) {
+    if (!req) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    ConnectionReleaseBuffer (conn, &req->url);
+    ConnectionReleaseBuffer (conn, &req->body);
+    ApiRequestDeinit (req);
+}
+
+bool ConnectionPerform (Connection* conn, ApiRequest* request, ApiResponseParser parser, void* out) {
+    if (!conn || !request) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    Str  response = ConnectionAcquireBuffer (conn);
+    bool res      = PerformRequest (conn, request, &response);
+
+    if (res) {
+        if (parser) {
+            res = parser (&response, out);
+        } else if (out) {
+            StrDeinit ((Str*)out);
+            *(Str*)out = response;
+            response   = StrInit();
+        }
+    }
+
+    ConnectionReleaseBuffer (conn, &response);
+    return res;
+}
+
+bool ConnectionMakeRequest (
+    Connection* conn,
+    Str*        request_url,
+    Str*        request_json,
+    Str*        response_json,
+    const char* request_method
+) {
+    if (!conn) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    ApiRequest request = ShallowRequest (request_url, request_json, request_method, NULL);
+    return PerformRequest (conn, &request, response_json);
+}
+
+bool ConnectionMakeUploadRequest (
+    Connection* conn,
+    Str*        request_url,
+    Str*        request_json,
+    Str*        response_json,
+    const char* request_method,
+    Str*        file_path
+) {
+    if (!conn) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    if (!file_path || !file_path->length) {
+        LOG_ERROR (
+            "Invalid file path. If uploading a file is not intended, then use MakeRequest "
+            "method "
+            "instead."
+        );
+        return false;
+    }
+
+    ApiRequest request = ShallowRequest (request_url, request_json, request_method, file_path);
+    return PerformRequest (conn, &request, response_json);
+}
+
+bool MakeRequest (
+    Str*        user_agent,
+    Str*        api_key,
+    Str*        request_url,
+    Str*        request_json,
+    Str*        response_json,
+    const char* request_method
+) {
+    if (!user_agent || !api_key) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    // shallow connection, strings are still owned by caller
+    Connection conn = {.user_agent = *user_agent, .api_key = *api_key};
+    bool res = ConnectionMakeRequest (&conn, request_url, request_json, response_json, request_method);
+    ConnectionPoolDestroy (conn.pool);
+
+    return res;
+}
+
+bool MakeUploadRequest (
+    Str*        user_agent,
+    Str*        api_key,
+    Str*        request_url,
+    Str*        request_json,
+    Str*        response_json,
+    const char* request_method,
+    Str*        file_path
+) {
+    if (!user_agent || !api_key) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    // shallow connection, strings are still owned by caller
+    Connection conn = {.user_agent = *user_agent, .api_key = *api_key};
+    bool       res  = ConnectionMakeUploadRequest (
+        &conn,
+        request_url,
+        request_json,
+        response_json,
+        request_method,
+        file_path
+    );
+    ConnectionPoolDestroy (conn.pool);
+
+    return res;
+}
+
+static ConnectionPool* PoolCreate (Connection* conn) {
+    ConnectionPool* pool = NEW (ConnectionPool);
+    if (!pool) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    pool->lock    = SysMutexCreate();
+    pool->idle    = (CurlHandles)VecInit();
+    pool->buffers = (Strs)VecInit();
+
+    if (conn->max_requests_per_sec || conn->adaptive_concurrency) {
+        size max_inflight = conn->max_inflight_requests;
+        pool->limiter     = LimiterCreate (
+            conn->max_requests_per_sec,
+            conn->adaptive_concurrency,
+            max_inflight ? max_inflight : CONNECTION_DEFAULT_MAX_INFLIGHT_REQUESTS
+        );
+    }
+
+    return pool;
+}
+
+void ConnectionPoolDestroy (ConnectionPool* pool) {
+    if (!pool) {
+        return;
+    }
+
+    // engine gives its handles back to the pool, so it goes first
+    AsyncEngineDestroy (pool->engine);
+    pool->engine = NULL;
+
+    LimiterDestroy (pool->limiter);
+    pool->limiter = NULL;
+
+    VecForeach (&pool->idle, curl, { curl_easy_cleanup (curl); });
+    VecDeinit (&pool->idle);
+    VecForeachPtr (&pool->buffers, buf, { StrDeinit (buf); });
+    VecDeinit (&pool->buffers);
+    SysMutexDestroy (pool->lock);
+
+    FREE (pool);
+}
+
+ConnectionPool* ConnectionPoolGet (Connection* conn) {
+    ConnectionPool* pool = conn->pool;
+    if (pool) {
+        return pool;
+    }
+
+    pool                 = PoolCreate (conn);
+    ConnectionPool* prev = SysAtomicCasPtr ((void* volatile*)&conn->pool, NULL, pool);
+    if (prev) {
+        ConnectionPoolDestroy (pool);
+        return prev;
+    }
+
+    return pool;
+}
+
+CURL* ConnectionPoolAcquire (ConnectionPool* pool) {
+    CURL* curl = NULL;
+
+    SysMutexLock (pool->lock);
+    pool->stats.requests++;
+    if (pool->idle.length) {
+        VecPopBack (&pool->idle, &curl);
+        pool->stats.pool_hits++;
+    } else {
+        pool->stats.pool_misses++;
+    }
+    SysMutexUnlock (pool->lock);
+
+    if (!curl) {
+        curl = curl_easy_init();
+        if (!curl) {
+            LOG_ERROR ("Failed to create a CURL handle. Cannot make requests.");
+            SysMutexLock (pool->lock);
+            pool->stats.failed_requests++;
+            SysMutexUnlock (pool->lock);
+        }
+    }
+
+    return curl;
+}
+
+Str ConnectionPoolAcquireBuffer (ConnectionPool* pool) {
+    Str buf = StrInit();
+
+    SysMutexLock (pool->lock);
+    if (pool->buffers.length) {
+        VecPopBack (&pool->buffers, &buf);
+        pool->stats.buffer_hits++;
+    } else {
+        pool->stats.buffer_misses++;
+    }
+    SysMutexUnlock (pool->lock);
+
+    return buf;
+}
+
+void ConnectionPoolReleaseBuffer (ConnectionPool* pool, size max_idle, Str* buf) {
+    // nothing worth keeping in buffers that never allocated or grew too large
+    if (buf->capacity && buf->capacity <= CONNECTION_MAX_POOLED_BUFFER_SIZE) {
+        if (!max_idle) {
+            max_idle = CONNECTION_DEFAULT_MAX_IDLE_BUFFERS;
+        }
+
+        StrClear (buf);
+
+        SysMutexLock (pool->lock);
+        if (pool->buffers.length < max_idle) {
+            VecPushBack (&pool->buffers, *buf);
+            *buf = StrInit();
+        }
+        SysMutexUnlock (pool->lock);
+    }
+
+    // pool full, or buffer not worth keeping
+    StrDeinit (buf);
+}
+
+LimiterOutcome TransferOutcome (Transfer* xfer) {
+    if (xfer->throttled) {
+        return LIMITER_OUTCOME_THROTTLED;
+    }
+    return xfer->failed ? LIMITER_OUTCOME_FAILURE : LIMITER_OUTCOME_SUCCESS;
+}
+
+bool ApiRequestIsHedgeable (ApiRequest* req) {
+    return req->method && !strcmp (req->method, "GET") && !req->file_path.length &&
+           !req->stream_key;
+}
+
+u64 TransferUploadBackoff (u32 retries) {
+    u64 wait = TRANSFER_UPLOAD_BACKOFF_MS << (retries < 8 ? retries : 8);
+    return wait < TRANSFER_UPLOAD_MAX_BACKOFF_MS ? wait : TRANSFER_UPLOAD_MAX_BACKOFF_MS;
+}
+
+void ConnectionPoolRelease (ConnectionPool* pool, CURL* curl, size max_idle, Transfer* xfer) {
+    bool       abandoned    = xfer && xfer->abandoned;
+    bool       failed       = !xfer || xfer->failed;
+    long       num_conns    = 0;
+    long       http_version = 0;
+    curl_off_t appconnect   = 0;
+    curl_off_t uploaded     = 0;
+    curl_off_t downloaded   = 0;
+    if (!failed) {
+        curl_easy_getinfo (curl, CURLINFO_NUM_CONNECTS, &num_conns);
+        curl_easy_getinfo (curl, CURLINFO_APPCONNECT_TIME_T, &appconnect);
+        curl_easy_getinfo (curl, CURLINFO_HTTP_VERSION, &http_version);
+        curl_easy_getinfo (curl, CURLINFO_SIZE_UPLOAD_T, &uploaded);
+        curl_easy_getinfo (curl, CURLINFO_SIZE_DOWNLOAD_T, &downloaded);
+
+        // download size is counted before content decoding, write callback sees decoded data
+        xfer->bytes = (TransferBytes) {
+            .sent_wire        = uploaded,
+            .sent_decoded     = xfer->body_size ? xfer->body_size : (u64)uploaded,
+            .received_wire    = downloaded,
+            .received_decoded = xfer->received,
+        };
+    }
+
+    // Reset options but keep live connections, DNS cache and TLS session cache alive.
+    curl_easy_reset (curl);
+
+    if (!max_idle) {
+        max_idle = CONNECTION_DEFAULT_MAX_IDLE_HANDLES;
+    }
+
+    SysMutexLock (pool->lock);
+    if (abandoned) {
+        // lost the race to its hedged copy, which is counted instead
+    } else if (xfer && xfer->throttled) {
+        pool->stats.throttled_requests++;
+    } else if (failed) {
+        pool->stats.failed_requests++;
+    } else if (num_conns) {
+        pool->stats.new_connections++;
+        // handshake happened only if a new connection was made over TLS
+        if (appconnect) {
+            pool->stats.tls_handshakes++;
+            pool->stats.tls_resumed += xfer->tls_resumed;
+        }
+    } else {
+        pool->stats.reused_connections++;
+    }
+    if (!failed && !abandoned) {
+        pool->stats.http2_requests         += http_version == CURL_HTTP_VERSION_2_0;
+        pool->stats.bytes.sent_wire        += xfer->bytes.sent_wire;
+        pool->stats.bytes.sent_decoded     += xfer->bytes.sent_decoded;
+        pool->stats.bytes.received_wire    += xfer->bytes.received_wire;
+        pool->stats.bytes.received_decoded += xfer->bytes.received_decoded;
+    }
+    if (pool->idle.length < max_idle) {
+        VecPushBack (&pool->idle, curl);
+        curl = NULL;
+    }
+    SysMutexUnlock (pool->lock);
+
+    // pool full, this one is extra
+    if (curl) {
+        curl_easy_cleanup (curl);
+    }
+}
+
+///
+/// Process-wide cache of DNS entries and TLS sessions, shared by handles of all connections.
+///
+/// Live connections are deliberately not shared here. Handles of all connections run at the
+/// same time from caller threads and engine threads, and libcurl does not support sharing
+/// a connection cache between handles running concurrently, locks or not. Each pooled handle
+/// and each engine's multi handle keeps its own connections alive instead.
+///
+typedef struct SharedCache {
+    CURLSH*   share;
+    SysMutex* locks[CURL_LOCK_DATA_LAST];
+} SharedCache;
+
+static SharedCache* shared_cache = NULL;
+
+static void SharedCacheLock (CURL* curl, curl_lock_data data, curl_lock_access access, void* user) {
+    (void)curl;
+    (void)access;
+    SysMutexLock (((SharedCache*)user)->locks[data]);
+}
+
+static void SharedCacheUnlock (CURL* curl, curl_lock_data data, void* user) {
+    (void)curl;
+    SysMutexUnlock (((SharedCache*)user)->locks[data]);
+}
+
+static void SharedCacheDestroy (SharedCache* cache) {
+    if (cache->share) {
+        curl_share_cleanup (cache->share);
+    }
+    for (size i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        SysMutexDestroy (cache->locks[i]);
+    }
+    FREE (cache);
+}
+
+///
+/// Get the process-wide share handle, creating it on first use.
+/// Lives until the process exits, since handles of any connection may still refer to it.
+///
+/// SUCCESS : Share handle.
+/// FAILURE : `NULL`, requests are then made without a shared cache.
+///
+static CURLSH* SharedCacheGet (void) {
+    SharedCache* cache = shared_cache;
+    if (cache) {
+        return cache->share;
+    }
+
+    cache = NEW (SharedCache);
+    if (!cache) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    for (size i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        cache->locks[i] = SysMutexCreate();
+    }
+
+    cache->share = curl_share_init();
+    if (!cache->share) {
+        LOG_ERROR ("Failed to create shared cache. DNS and TLS sessions won't be shared.");
+        SharedCacheDestroy (cache);
+        return NULL;
+    }
+
+    curl_share_setopt (cache->share, CURLSHOPT_LOCKFUNC, SharedCacheLock);
+    curl_share_setopt (cache->share, CURLSHOPT_UNLOCKFUNC, SharedCacheUnlock);
+    curl_share_setopt (cache->share, CURLSHOPT_USERDATA, cache);
+    curl_share_setopt (cache->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt (cache->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+    SharedCache* prev = SysAtomicCasPtr ((void* volatile*)&shared_cache, NULL, cache);
+    if (prev) {
+        SharedCacheDestroy (cache);
+        return prev->share;
+    }
+
+    return cache->share;
+}
+
+///
+/// Check whether handshake of connection used by given handle resumed a cached TLS session.
+/// Only known for OpenSSL backend, reports false for everything else.
+///
+static bool TlsSessionResumed (CURL* curl) {
+#ifdef REAI_HAVE_OPENSSL
+    struct curl_tlssessioninfo* info = NULL;
+    if (curl_easy_getinfo (curl, CURLINFO_TLS_SSL_PTR, &info) != CURLE_OK || !info ||
+        info->backend != CURLSSLBACKEND_OPENSSL || !info->internals) {
+        return false;
+    }
+
+    return SSL_session_reused ((SSL*)info->internals) == 1;
+#else
+    (void)curl;
+    return false;
+#endif
+}
+
+///
+/// Parse numeric value of header with given name out of given header line.
+/// Header line is not NUL terminated.
+///
+/// name[in] : Lowercase header name, including the trailing colon.
+///
+/// SUCCESS : true, and `value` holds header value.
+/// FAILURE : false if line is some other header, or value is not a number.
+///
+static bool ParseHeaderNumber (const char* line, size line_len, const char* name, u64* value) {
+    size namelen = strlen (name);
+
+    if (line_len <= namelen) {
+        return false;
+    }
+
+    // header names are case insensitive
+    for (size i = 0; i < namelen; i++) {
+        if (tolower ((unsigned char)line[i]) != name[i]) {
+            return false;
+        }
+    }
+
+    size i = namelen;
+    while (i < line_len && (line[i] == ' ' || line[i] == '\t')) {
+        i++;
+    }
+
+    u64  number = 0;
+    bool digits = false;
+    for (; i < line_len && isdigit ((unsigned char)line[i]); i++) {
+        // anything this large is bogus anyway, and must not overflow
+        if (number > ((u64)1 << 48)) {
+            return false;
+        }
+        number = number * 10 + (line[i] - '0');
+        digits = true;
+    }
+
+    *value = number;
+    return digits;
+}
+
+static size CURLResponseHeaderCallback (char* ptr, size sz, size nmemb, Transfer* xfer) {
+    size header_size = sz * nmemb;
+
+    // handshake is complete by the time first header arrives
+    if (!xfer->tls_checked) {
+        xfer->tls_checked = true;
+        xfer->tls_resumed = TlsSessionResumed (xfer->curl);
+    }
+
+    // Reserve whole body at once instead of growing buffer chunk by chunk.
+    // For compressed responses this is the compressed size, still a better start than nothing.
+    // Streamed responses only keep the envelope, so there's nothing to reserve for.
+    u64 value = 0;
+    if (!xfer->stream && ParseHeaderNumber (ptr, header_size, "content-length:", &value) &&
+        value && value <= TRANSFER_MAX_PRESIZE) {
+        // one more for the terminating NUL, so filling it exactly doesn't reallocate
+        StrReserve (xfer->response, xfer->response->length + value + 1);
+    }
+
+    // only the delay-seconds form is understood, HTTP dates fall back to a default wait
+    if (ParseHeaderNumber (ptr, header_size, "retry-after:", &value)) {
+        xfer->retry_after = value * 1000;
+    }
+
+    return header_size;
+}
+
+static size CURLResponseWriteCallback (void* ptr, size sz, size nmemb, Transfer* xfer) {
+    if (!ptr || !xfer) {
+        LOG_ERROR ("Invalid arguments.");
+        return 0;
+    }
+
+    size received_size = sz * nmemb;
+    xfer->received    += received_size;
+
+    // returning less than received aborts the transfer
+    if (xfer->stream) {
+        return JsonStreamFeed (xfer->stream, (const char*)ptr, received_size) ? received_size : 0;
+    }
+
+    StrPushBackCstr (xfer->response, (char*)ptr, received_size);
+    return received_size;
+}
+
+///
+/// Gzip given request body into `out`.
+///
+/// SUCCESS : true, and `out` holds compressed body.
+/// FAILURE : false if compression is not available or does not help.
+///
+static bool CompressBody (Str* body, Str* out) {
+#ifdef REAI_HAVE_ZLIB
+    z_stream zs = {0};
+    // 16 + MAX_WBITS selects gzip wrapping instead of zlib's own
+    if (deflateInit2 (&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) !=
+        Z_OK) {
+        LOG_ERROR ("Failed to initialize request body compression.");
+        return false;
+    }
+
+    StrResize (out, deflateBound (&zs, body->length));
+
+    zs.next_in   = (Bytef*)body->data;
+    zs.avail_in  = body->length;
+    zs.next_out  = (Bytef*)out->data;
+    zs.avail_out = out->length;
+
+    int ret = deflate (&zs, Z_FINISH);
+    deflateEnd (&zs);
+
+    if (ret != Z_STREAM_END || zs.total_out >= body->length) {
+        StrClear (out);
+        return false;
+    }
+
+    StrResize (out, zs.total_out);
+    return true;
+#else
+    (void)body;
+    (void)out;
+    return false;
+#endif
+}
+
+///
+/// Hand next chunk of file (or memory) being uploaded over to CURL. CURL asks for the next chunk
+/// only once it has sent the previous one, so time between calls is how long a chunk took to send.
+///
+static size CURLUploadReadCallback (char* buffer, size sz, size nitems, void* arg) {
+    Transfer* xfer = (Transfer*)arg;
+    u64       now  = SysGetMonotonicTimeMs();
+
+    if (xfer->upload.chunks) {
+        u64 took                   = now - xfer->chunk_started;
+        xfer->upload.last_chunk_ms = took;
+        if (took > xfer->upload.max_chunk_ms) {
+            xfer->upload.max_chunk_ms = took;
+        }
+    }
+
+    size read_size = 0;
+    if (xfer->upload_file) {
+        read_size = fread (buffer, 1, sz * nitems, xfer->upload_file);
+        if (!read_size && ferror (xfer->upload_file)) {
+            LOG_ERROR ("Failed to read file being uploaded.");
+            return CURL_READFUNC_ABORT;
+        }
+    } else {
+        u64 left             = xfer->upload.total - xfer->upload_offset;
+        read_size            = left < sz * nitems ? left : sz * nitems;
+        memcpy (buffer, xfer->upload_data + xfer->upload_offset, read_size);
+        xfer->upload_offset += read_size;
+    }
+
+    if (read_size) {
+        xfer->upload.chunks++;
+        xfer->chunk_started = now;
+    }
+    return read_size;
+}
+
+///
+/// Rewind data being uploaded, for when CURL has to send the body again (e.g. on redirect).
+///
+static int CURLUploadSeekCallback (void* arg, curl_off_t offset, int origin) {
+    Transfer* xfer = (Transfer*)arg;
+
+    if (!xfer->upload_file) {
+        if (origin != SEEK_SET || offset < 0 || (u64)offset > xfer->upload.total) {
+            return CURL_SEEKFUNC_CANTSEEK;
+        }
+        xfer->upload_offset = (u64)offset;
+        return CURL_SEEKFUNC_OK;
+    }
+
+#ifdef _WIN32
+    int res = _fseeki64 (xfer->upload_file, offset, origin);
+#else
+    int res = fseeko (xfer->upload_file, (off_t)offset, origin);
+#endif
+    return res ? CURL_SEEKFUNC_CANTSEEK : CURL_SEEKFUNC_OK;
+}
+
+///
+/// Abort transfer once its call expires. For uploads, also update progress, and report it to
+/// user if anything was sent since last time. CURL calls this at least once a second.
+///
+static int CURLProgressCallback (
+    void*      arg,
+    curl_off_t dltotal,
+    curl_off_t dlnow,
+    curl_off_t ultotal,
+    curl_off_t ulnow
+) {
+    (void)dltotal;
+    (void)dlnow;
+    (void)ultotal;
+
+    Transfer* xfer = (Transfer*)arg;
+
+    // non-zero aborts the transfer
+    if (RequestOptionsExpired (&xfer->call)) {
+        return 1;
+    }
+
+    if (!xfer->upload_file && !xfer->upload_data) {
+        return 0;
+    }
+
+    // multipart framing is counted by CURL too, but isn't part of the file
+    u64 sent = (u64)ulnow < xfer->upload.total ? (u64)ulnow : xfer->upload.total;
+    if (sent == xfer->upload.sent) {
+        return 0;
+    }
+
+    u64 elapsed                = SysGetMonotonicTimeMs() - xfer->upload_started;
+    xfer->upload.sent          = sent;
+    xfer->upload.elapsed_ms    = elapsed;
+    xfer->upload.bytes_per_sec = elapsed ? sent * 1000 / elapsed : 0;
+
+    if (xfer->upload_progress) {
+        xfer->upload_progress (&xfer->upload, xfer->upload_progress_data);
+    }
+    return 0;
+}
+
+const char* FileBaseName (Str* file_path) {
+    const char* name = file_path->data;
+    for (const char* c = file_path->data; *c; c++) {
+        if (*c == '/' || *c == '\\') {
+            name = c + 1;
+        }
+    }
+    return name;
+}
+
+///
+/// Open file to be uploaded for reading.
+///
+/// SUCCESS : Opened file, and its size in `file_size`.
+/// FAILURE : NULL
+///
+static FILE* OpenUploadFile (Str* file_path, u64* file_size) {
+    i64 fsize = SysGetFileSize (file_path->data);
+    if (fsize < 0) {
+        LOG_ERROR ("Failed to get size of '%s'.", file_path->data);
+        return NULL;
+    }
+
+    FILE* file = NULL;
+    int   e    = 0;
+#ifdef _WIN32
+    e = fopen_s (&file, file_path->data, "rb");
+#else
+    file = fopen (file_path->data, "rb");
+    if (!file) {
+        e = errno;
+    }
+#endif
+    if (e || !file) {
+        Str syserr;
+        StrInitStack (&syserr, SYS_ERROR_STR_MAX_LENGTH, {
+            LOG_ERROR ("fopen() failed : %s.", SysStrError (e, &syserr)->data);
+        });
+        return NULL;
+    }
+
+    *file_size = (u64)fsize;
+    return file;
+}
+
+static bool ua_already_printed = false;
+
+///
+/// Wrap strings owned by caller into a request, without copying them.
+/// Must not be deinited.
+///
+static ApiRequest ShallowRequest (
+    Str*        request_url,
+    Str*        request_json,
+    const char* request_method,
+    Str*        file_path
+) {
+    ApiRequest request = ApiRequestInit();
+    request.method     = request_method;
+    if (request_url) {
+        request.url = *request_url;
+    }
+    if (request_json) {
+        request.body = *request_json;
+    }
+    if (file_path) {
+        request.file_path = *file_path;
+    }
+    return request;
+}
+
+///
+/// Make a blocking request through async engine of the connection, so it shares
+/// a multiplexed connection with all other requests in flight on that connection,
+/// and can be hedged.
+///
+static bool PerformThroughEngine (Connection* conn, ApiRequest* request, Str* response_json) {
+    if (!request->url.length) {
+        LOG_ERROR ("Invalid request url");
+        return false;
+    }
+
+    // engine takes over the request, so give it a copy
+    ApiRequest copy    = ConnectionAcquireRequest (conn);
+    copy.method        = request->method;
+    copy.stream_key    = request->stream_key;
+    copy.stream_reader = request->stream_reader;
+    copy.stream_ctx    = request->stream_ctx;
+    copy.upload_stats  = request->upload_stats;
+    copy.upload_data   = request->upload_data;
+    copy.upload_size   = request->upload_size;
+    copy.options       = request->options;
+    StrMerge (&copy.url, &request->url);
+    if (request->body.length) {
+        StrMerge (&copy.body, &request->body);
+    }
+    if (request->file_path.length) {
+        StrInitCopy (&copy.file_path, &request->file_path);
+    }
+
+    Str        response = ConnectionAcquireBuffer (conn);
+    ApiFuture* future   = ConnectionSubmit (conn, &copy, NULL, &response, NULL, NULL);
+    bool       res      = future && ApiFutureWait (future);
+    ApiFutureRelease (future);
+    ConnectionReleaseRequest (conn, &copy);
+
+    if (response_json) {
+        if (res) {
+            StrMerge (response_json, &response);
+        } else {
+            StrDeinit (response_json);
+        }
+    }
+    ConnectionReleaseBuffer (conn, &response);
+
+    return res;
+}
+
+///
+/// Make a single attempt at given request on a pooled handle, blocking until done.
+///
+static bool PerformOnce (
+    Connection*     conn,
+    ConnectionPool* pool,
+    ApiRequest*     request,
+    Str*            response_json,
+    Transfer*       xfer,
+    u32             upload_retries
+) {
+    xfer->failed = true;
+
+    CURL* curl = ConnectionPoolAcquire (pool);
+    if (!curl) {
+        return false;
+    }
+
+    TransferOptions opts = {
+        .ca_bundle            = &conn->ca_bundle,
+        .http2                = false,
+        .compress_above       = conn->compress_requests_above,
+        .upload_chunk_size    = conn->upload_chunk_size,
+        .upload_stall_timeout = conn->upload_stall_timeout,
+        .upload_progress      = conn->upload_progress,
+        .upload_progress_data = conn->upload_progress_data,
+    };
+
+    JsonStream stream =
+        JsonStreamInit (request->stream_key, request->stream_reader, request->stream_ctx);
+
+    if (!TransferSetup (
+            xfer,
+            curl,
+            &conn->user_agent,
+            &conn->api_key,
+            &request->url,
+            &request->body,
+            response_json,
+            request->method,
+            request->file_path.length ? &request->file_path : NULL,
+            request->upload_data,
+            request->upload_size,
+            request->stream_key ? &stream : NULL,
+            &request->options,
+            &opts
+        )) {
+        ConnectionPoolRelease (pool, curl, conn->max_idle_handles, NULL);
+        JsonStreamDeinit (&stream);
+        return false;
+    }
+
+    xfer->upload.retries = upload_retries;
+
+    bool res = TransferFinish (xfer, curl_easy_perform (curl));
+    ConnectionPoolRelease (pool, curl, conn->max_idle_handles, xfer);
+    JsonStreamDeinit (&stream);
+
+    if (request->upload_stats && request->file_path.length) {
+        *request->upload_stats = xfer->upload;
+    }
+    return res;
+}
+
+///
+/// Sleep for given time, waking up early if call expires meanwhile.
+///
+/// RETURN : true if slept whole time, false if call expired.
+///
+static bool SleepUnlessExpired (const RequestOptions* call, u64 wait) {
+    u64 until = SysGetMonotonicTimeMs() + wait;
+    for (u64 now = SysGetMonotonicTimeMs(); now < until; now = SysGetMonotonicTimeMs()) {
+        if (RequestOptionsExpired (call)) {
+            return false;
+        }
+        SysSleepMs (until - now < 50 ? until - now : 50);
+    }
+    return !RequestOptionsExpired (call);
+}
+
+///
+/// Get a request admitted by the limiter, giving up if call expires first.
+/// Waiting out a `Retry-After` or for a free slot counts against the deadline of the call.
+///
+/// SUCCESS : true, and request must be released with `LimiterRelease`.
+/// FAILURE : false, if call got cancelled or ran out of time.
+///
+static bool AcquireUnlessExpired (Limiter* limiter, const RequestOptions* call) {
+    // nothing to notice, block on the limiter itself
+    if (!call->deadline && !call->cancel) {
+        LimiterAcquire (limiter);
+        return true;
+    }
+
+    u64 wait = 0;
+    while (!LimiterTryAcquire (limiter, &wait)) {
+        if (!SleepUnlessExpired (call, wait < LIMITER_POLL_MS ? wait : LIMITER_POLL_MS)) {
+            LOG_ERROR ("Call got cancelled or ran out of time while throttled.");
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool PerformRequest (Connection* conn, ApiRequest* request, Str* response_json) {
+    if (conn->options) {
+        request->options = *conn->options;
+    }
+
+    if (!ApiBackendIsCurl (conn->backend)) {
+        return ApiBackendDispatch (conn->backend, conn, request, response_json);
+    }
+
+    return ConnectionPerformCurl (conn, request, response_json);
+}
+
+bool ConnectionPerformCurl (Connection* conn, ApiRequest* request, Str* response_json) {
+    if (conn->http2 || (conn->hedge_percentile && ApiRequestIsHedgeable (request))) {
+        return PerformThroughEngine (conn, request, response_json);
+    }
+
+    ConnectionPool* pool        = ConnectionPoolGet (conn);
+    u32             throttled   = 0;
+    u32             interrupted = 0;
+
+    // limiter (if any) makes sure we back off while server throttles
+    while (true) {
+        if (pool->limiter && !AcquireUnlessExpired (pool->limiter, &request->options)) {
+            return false;
+        }
+
+        u64      started = SysGetMonotonicTimeMs();
+        Transfer xfer    = {0};
+        bool     res     = PerformOnce (conn, pool, request, response_json, &xfer, interrupted);
+
+        if (pool->limiter) {
+            LimiterRelease (
+                pool->limiter,
+                TransferOutcome (&xfer),
+                SysGetMonotonicTimeMs() - started,
+                xfer.retry_after
+            );
+        }
+
+        if (res) {
+            return true;
+        }
+
+        if (xfer.throttled && pool->limiter && throttled < LIMITER_MAX_RETRIES) {
+            throttled++;
+        } else if (xfer.interrupted && interrupted < conn->upload_retries) {
+            u64 wait = TransferUploadBackoff (interrupted++);
+            LOG_ERROR ("Upload interrupted, restarting it in %llu ms.", wait);
+            if (!SleepUnlessExpired (&request->options, wait)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+
+        // failed transfer leaves response deinited
+        if (response_json) {
+            *response_json = StrInit();
+        }
+    }
+}
+
+bool TransferSetup (
+    Transfer*              xfer,
+    CURL*                  curl,
+    Str*                   user_agent,
+    Str*                   api_key,
+    Str*                   request_url,
+    Str*                   request_json,
+    Str*                   response_json,
+    const char*            request_method,
+    Str*                   file_path,
+    const void*            upload_data,
+    size                   upload_size,
+    JsonStream*            stream,
+    const RequestOptions*  call,
+    const TransferOptions* opts
+) {
+    if (!user_agent || !user_agent->length) {
+        LOG_ERROR ("Invalid user agent");
+        return false;
+    }
+
+    if (!api_key || !api_key->length) {
+        LOG_ERROR ("Invalid API key");
+        return false;
+    }
+
+    if (!request_url || !request_url->length) {
+        LOG_ERROR ("Invalid request url");
+        return false;
+    }
+
+    if (!request_method) {
+        LOG_ERROR ("Invalid request method.");
+        return false;
+    }
+
+    if (RequestOptionsExpired (call)) {
+        LOG_ERROR ("Call got cancelled or ran out of time, not making request.");
+        return false;
+    }
+
+    curl_mime* mime        = NULL;
+    FILE*      upload_file = NULL;
+    u64        file_size   = upload_data ? upload_size : 0;
+    if (file_path && !upload_data) {
+        upload_file = OpenUploadFile (file_path, &file_size);
+        if (!upload_file) {
+            return false;
+        }
+    }
+
+    if (file_path) {
+        /* create a new mime */
+        mime = curl_mime_init (curl);
+        if (!mime) {
+            LOG_ERROR ("CURL failed to create mime.");
+            if (upload_file) {
+                fclose (upload_file);
+            }
+            return false;
+        }
+
+        /* create mimepart for multipart data */
+        curl_mimepart* mimepart = curl_mime_addpart (mime);
+        if (!mimepart) {
+            LOG_ERROR ("CURL failed to add mime part.");
+            curl_mime_free (mime);
+            if (upload_file) {
+                fclose (upload_file);
+            }
+            return false;
+        }
+
+        /* set part info, data is read a chunk at a time as CURL sends it */
+        curl_mime_name (mimepart, "file");
+        curl_mime_filename (mimepart, FileBaseName (file_path));
+        curl_mime_data_cb (
+            mimepart,
+            (curl_off_t)file_size,
+            CURLUploadReadCallback,
+            CURLUploadSeekCallback,
+            NULL,
+            xfer
+        );
+
+        LOG_INFO ("UPLOAD %s : '%s'", upload_data ? "DATA" : "FILE", file_path->data);
+    }
+
+    xfer->curl        = curl;
+    xfer->tls_checked = false;
+    xfer->tls_resumed = false;
+    xfer->failed      = false;
+    xfer->abandoned   = false;
+    xfer->throttled   = false;
+    xfer->retry_after = 0;
+    xfer->body_size   = 0;
+    xfer->received    = 0;
+    xfer->bytes       = (TransferBytes) {0};
+    xfer->packed_body = StrInit();
+    xfer->stream      = stream;
+
+    xfer->upload_file          = upload_file;
+    xfer->upload_data          = upload_data;
+    xfer->upload_offset        = 0;
+    xfer->upload               = (UploadProgress) {.total = file_size};
+    xfer->upload_started       = SysGetMonotonicTimeMs();
+    xfer->chunk_started        = xfer->upload_started;
+    xfer->upload_progress      = opts->upload_progress;
+    xfer->upload_progress_data = opts->upload_progress_data;
+    xfer->interrupted          = false;
+    xfer->call                 = call ? *call : (RequestOptions)RequestOptionsInit();
+
+    // use our own Str if none provided
+    xfer->my_response = StrInit();
+    xfer->response    = response_json ? response_json : &xfer->my_response;
+
+    // Authorization header
+    Str auth = StrInit();
+    StrPrintf (&auth, "Authorization: %s", api_key->data);
+
+    struct curl_slist* headers = NULL;
+    headers                    = curl_slist_append (headers, auth.data);
+    StrDeinit (&auth);
+
+    if (request_json && request_json->length) {
+        headers         = curl_slist_append (headers, "Content-Type: application/json");
+        xfer->body_size = request_json->length;
+        LOG_INFO ("REQUEST.JSON: '%s'", request_json->data);
+
+        Str* body = request_json;
+        if (opts->compress_above && request_json->length > opts->compress_above &&
+            CompressBody (request_json, &xfer->packed_body)) {
+            headers = curl_slist_append (headers, "Content-Encoding: gzip");
+            body    = &xfer->packed_body;
+        }
+
+        curl_easy_setopt (curl, CURLOPT_POSTFIELDSIZE_LARGE, (curl_off_t)body->length);
+        curl_easy_setopt (curl, CURLOPT_POSTFIELDS, body->data);
+    }
+
+    Str hdr_ua = StrInit();
+    StrPrintf (&hdr_ua, "User-Agent: %s", user_agent->data);
+    headers = curl_slist_append (headers, hdr_ua.data);
+
+    if (!ua_already_printed) {
+        LOG_INFO ("USER_AGENT = %s", hdr_ua.data);
+        ua_already_printed = true;
+    }
+
+    StrDeinit (&hdr_ua);
+
+    if (mime) {
+        curl_easy_setopt (curl, CURLOPT_MIMEPOST, mime);
+    }
+    curl_easy_setopt (curl, CURLOPT_URL, request_url->data);
+    curl_easy_setopt (curl, CURLOPT_CUSTOMREQUEST, request_method);
+    curl_easy_setopt (curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1);
+    curl_easy_setopt (curl, CURLOPT_USERAGENT, "creait");
+    curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION, CURLResponseWriteCallback);
+    curl_easy_setopt (curl, CURLOPT_WRITEDATA, xfer);
+    curl_easy_setopt (curl, CURLOPT_ACCEPT_ENCODING, ""); // everything libcurl can decode
+    curl_easy_setopt (curl, CURLOPT_HEADERFUNCTION, CURLResponseHeaderCallback);
+    curl_easy_setopt (curl, CURLOPT_HEADERDATA, xfer);
+    // large files take as long as they take, only an upload that stopped moving is given up
+    u64 timeout         = mime ? 0 : TRANSFER_TIMEOUT_MS;
+    u64 connect_timeout = TRANSFER_CONNECT_TIMEOUT_MS;
+    if (mime) {
+        size chunk = opts->upload_chunk_size;
+        long stall = opts->upload_stall_timeout;
+        chunk      = chunk ? chunk : CONNECTION_DEFAULT_UPLOAD_CHUNK_SIZE;
+        stall      = stall ? stall : CONNECTION_DEFAULT_UPLOAD_STALL_TIMEOUT;
+
+        curl_easy_setopt (curl, CURLOPT_UPLOAD_BUFFERSIZE, (long)chunk);
+        curl_easy_setopt (curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+        curl_easy_setopt (curl, CURLOPT_LOW_SPEED_TIME, stall);
+    }
+
+    // no single request may outlive the call it's made for
+    if (xfer->call.deadline) {
+        u64 now         = SysGetMonotonicTimeMs();
+        u64 remaining   = xfer->call.deadline > now ? xfer->call.deadline - now : 1;
+        remaining       = remaining < TRANSFER_MAX_TIMEOUT_MS ? remaining : TRANSFER_MAX_TIMEOUT_MS;
+        timeout         = timeout && timeout < remaining ? timeout : remaining;
+        connect_timeout = connect_timeout < remaining ? connect_timeout : remaining;
+    }
+
+    if (timeout) {
+        curl_easy_setopt (curl, CURLOPT_TIMEOUT_MS, (long)timeout);
+    }
+    curl_easy_setopt (curl, CURLOPT_CONNECTTIMEOUT_MS, (long)connect_timeout);
+
+    if (mime || xfer->call.cancel) {
+        curl_easy_setopt (curl, CURLOPT_NOPROGRESS, 0L);
+        curl_easy_setopt (curl, CURLOPT_XFERINFOFUNCTION, CURLProgressCallback);
+        curl_easy_setopt (curl, CURLOPT_XFERINFODATA, xfer);
+    }
+    curl_easy_setopt (curl, CURLOPT_TCP_KEEPALIVE, 1L);
+
+    if (opts->ca_bundle && opts->ca_bundle->length) {
+        curl_easy_setopt (curl, CURLOPT_CAINFO, opts->ca_bundle->data);
+    }
+
+    // HTTP/2 is only ever negotiated over TLS, plain HTTP has nothing to wait for
+    if (opts->http2 && !strncmp (request_url->data, "https://", 8)) {
+        // ALPN picks HTTP/1.1 on its own if server does not speak HTTP/2
+        curl_easy_setopt (curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt (curl, CURLOPT_PIPEWAIT, 1L);
+    }
+
+    CURLSH* share = SharedCacheGet();
+    if (share) {
+        curl_easy_setopt (curl, CURLOPT_SHARE, share);
+    }
+
+    xfer->headers = headers;
+    xfer->mime    = mime;
+
+    return true;
+}
+
+bool TransferFinish (Transfer* xfer, CURLcode retcode) {
+    curl_slist_free_all (xfer->headers);
+    xfer->headers = NULL;
+    if (xfer->mime) {
+        curl_mime_free (xfer->mime);
+        xfer->mime = NULL;
+    }
+
+    if (xfer->upload_file || xfer->upload_data) {
+        if (xfer->upload_file) {
+            fclose (xfer->upload_file);
+            xfer->upload_file = NULL;
+        }
+        xfer->upload_data = NULL;
+
+        u64 elapsed                = SysGetMonotonicTimeMs() - xfer->upload_started;
+        xfer->upload.elapsed_ms    = elapsed;
+        xfer->upload.bytes_per_sec = elapsed ? xfer->upload.sent * 1000 / elapsed : 0;
+
+        // network gave up midway, sending it all again may well succeed, if there's time left
+        switch (retcode) {
+            case CURLE_COULDNT_CONNECT :
+            case CURLE_SEND_ERROR :
+            case CURLE_RECV_ERROR :
+            case CURLE_OPERATION_TIMEDOUT :
+            case CURLE_GOT_NOTHING :
+            case CURLE_PARTIAL_FILE :
+            case CURLE_HTTP2 :
+            case CURLE_HTTP2_STREAM :
+                xfer->interrupted = !xfer->abandoned && !RequestOptionsExpired (&xfer->call);
+                break;
+            default :
+                break;
+        }
+    }
+
+    // throttled request was not processed, and is safe to retry
+    long status = 0;
+    curl_easy_getinfo (xfer->curl, CURLINFO_RESPONSE_CODE, &status);
+    xfer->throttled = status == 429;
+    if (retcode == CURLE_OK && xfer->throttled) {
+        LOG_ERROR ("Server is throttling requests.");
+        retcode = CURLE_HTTP_RETURNED_ERROR;
+    }
+
+    // streamed elements are gone, only envelope is left to be parsed
+    if (retcode == CURLE_OK && xfer->stream && !JsonStreamFinish (xfer->stream, xfer->response)) {
+        retcode = CURLE_WEIRD_SERVER_REPLY;
+    }
+    xfer->stream = NULL;
+
+    // log response always!
+    LOG_INFO ("RESPONSE.JSON: '%s'", xfer->response->data);
+
+    if (retcode != CURLE_OK) {
+        if (xfer->abandoned) {
+            // lost the race to its hedged copy, nothing went wrong
+        } else if (RequestOptionsExpired (&xfer->call)) {
+            LOG_ERROR ("Request aborted, call got cancelled or ran out of time.");
+        } else {
+            LOG_ERROR ("curl_easy_perform() failed: %s", curl_easy_strerror (retcode));
+        }
+        StrDeinit (xfer->response);
+    }
+
+    // if we used our json, then deinit that
+    StrDeinit (&xfer->my_response);
+    StrDeinit (&xfer->packed_body);
+    xfer->response = NULL;
+    xfer->failed   = retcode != CURLE_OK;
+
+    return retcode == CURLE_OK;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file Limiter.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include <Reai/Log.h>
+#include <Reai/Sys.h>
+#include <Reai/Util/Vec.h>
+
+#include "Limiter.h"
+
+/// Wait used when server throttles a request without saying for how long.
+#define LIMITER_DEFAULT_RETRY_AFTER_MS 1000
+
+/// Recent latency above this many times the long term average (plus slack) means server is
+/// getting overloaded. Single samples are too noisy to go by, so both are moving averages.
+#define LIMITER_LATENCY_TOLERANCE 2
+#define LIMITER_LATENCY_SLACK_MS  10
+#define LIMITER_RECENT_SMOOTHING  0.2
+#define LIMITER_BASELINE_SMOOTHING 0.01
+
+/// Concurrency limit is multiplied by these on throttling and on latency growing.
+#define LIMITER_THROTTLE_DECREASE 0.5
+#define LIMITER_LATENCY_DECREASE  0.9
+
+struct Limiter {
+    SysMutex* lock;
+    SysCond*  cond; /**< @b Signalled when a request leaves. */
+    void (*wake) (void* ctx);
+    void* wake_ctx;
+
+    // token bucket
+    u32    rate; /**< @b Tokens added per second. 0 if bucket is disabled. */
+    double tokens;
+    double burst; /**< @b Max tokens bucket holds. */
+    u64    refilled_at;
+
+    // AIMD concurrency limit
+    bool   adaptive;
+    double limit;
+    size   max_limit;
+    size   inflight;
+    bool   slow_start;   /**< @b Grow limit exponentially until first decrease. */
+    u64    decreased_at; /**< @b Requests admitted before this don't decrease limit again. */
+
+    // latency averages
+    bool   has_latency;
+    double recent;   /**< @b Quickly moving average, follows current load. */
+    double baseline; /**< @b Slowly moving average, follows the server. */
+
+    u64 retry_until; /**< @b Nothing is admitted before this time. */
+};
+
+Limiter* LimiterCreate (u32 rate, bool adaptive, size max_concurrency) {
+    Limiter* limiter = NEW (Limiter);
+    if (!limiter) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    max_concurrency = max_concurrency ? max_concurrency : 1;
+
+    limiter->lock        = SysMutexCreate();
+    limiter->cond        = SysCondCreate();
+    limiter->rate        = rate;
+    limiter->burst       = rate ? rate : 1;
+    limiter->tokens      = limiter->burst;
+    limiter->refilled_at = SysGetMonotonicTimeMs();
+    limiter->adaptive    = adaptive;
+    limiter->max_limit   = max_concurrency;
+    limiter->limit       = adaptive ? 1 : max_concurrency;
+    limiter->slow_start  = adaptive;
+
+    return limiter;
+}
+
+void LimiterDestroy (Limiter* limiter) {
+    if (!limiter) {
+        return;
+    }
+
+    SysCondDestroy (limiter->cond);
+    SysMutexDestroy (limiter->lock);
+    FREE (limiter);
+}
+
+void LimiterSetWakeup (Limiter* limiter, void (*wake) (void* ctx), void* ctx) {
+    SysMutexLock (limiter->lock);
+    limiter->wake     = wake;
+    limiter->wake_ctx = ctx;
+    SysMutexUnlock (limiter->lock);
+}
+
+///
+/// Admit a request if limits allow. Lock must be held.
+///
+static bool Admit (Limiter* limiter, u64 now, u64* wait) {
+    if (now < limiter->retry_until) {
+        *wait = limiter->retry_until - now;
+        return false;
+    }
+
+    if (limiter->inflight >= (size)limiter->limit) {
+        *wait = LIMITER_WAIT_FOREVER;
+        return false;
+    }
+
+    if (limiter->rate) {
+        limiter->tokens      += (double)(now - limiter->refilled_at) * limiter->rate / 1000.0;
+        limiter->tokens       = limiter->tokens > limiter->burst ? limiter->burst : limiter->tokens;
+        limiter->refilled_at  = now;
+
+        if (limiter->tokens < 1) {
+            *wait = (u64)((1 - limiter->tokens) * 1000.0 / limiter->rate) + 1;
+            return false;
+        }
+        limiter->tokens -= 1;
+    }
+
+    limiter->inflight++;
+    *wait = 0;
+    return true;
+}
+
+bool LimiterTryAcquire (Limiter* limiter, u64* wait) {
+    SysMutexLock (limiter->lock);
+    bool admitted = Admit (limiter, SysGetMonotonicTimeMs(), wait);
+    SysMutexUnlock (limiter->lock);
+
+    return admitted;
+}
+
+void LimiterAcquire (Limiter* limiter) {
+    u64 wait = 0;
+
+    SysMutexLock (limiter->lock);
+    while (!Admit (limiter, SysGetMonotonicTimeMs(), &wait)) {
+        if (wait == LIMITER_WAIT_FOREVER) {
+            SysCondWait (limiter->cond, limiter->lock);
+        } else {
+            SysCondWaitTimeout (limiter->cond, limiter->lock, wait);
+        }
+    }
+    SysMutexUnlock (limiter->lock);
+}
+
+///
+/// Multiply concurrency limit by given factor, once per round trip. Lock must be held.
+///
+static void Decrease (Limiter* limiter, double factor, u64 now, u64 latency) {
+    // admitted before last decrease, so it says nothing about current limit
+    if (!limiter->adaptive || now - latency < limiter->decreased_at) {
+        return;
+    }
+
+    limiter->limit        = limiter->limit * factor < 1 ? 1 : limiter->limit * factor;
+    limiter->decreased_at = now;
+    limiter->slow_start   = false;
+}
+
+///
+/// Grow concurrency limit by one per round trip, or double it during slow start.
+/// Lock must be held.
+///
+static void Increase (Limiter* limiter) {
+    if (!limiter->adaptive) {
+        return;
+    }
+
+    limiter->limit += limiter->slow_start ? 1 : 1 / limiter->limit;
+    if (limiter->limit > limiter->max_limit) {
+        limiter->limit = limiter->max_limit;
+    }
+}
+
+///
+/// Update latency averages with given sample. Lock must be held.
+///
+/// RETURN : true if recent latency grew well beyond its long term average.
+///
+static bool Observe (Limiter* limiter, u64 latency) {
+    if (!limiter->has_latency) {
+        limiter->has_latency = true;
+        limiter->recent      = latency;
+        limiter->baseline    = latency;
+    }
+
+    limiter->recent   += LIMITER_RECENT_SMOOTHING * ((double)latency - limiter->recent);
+    limiter->baseline += LIMITER_BASELINE_SMOOTHING * ((double)latency - limiter->baseline);
+
+    return limiter->recent > limiter->baseline * LIMITER_LATENCY_TOLERANCE + LIMITER_LATENCY_SLACK_MS;
+}
+
+void LimiterRelease (Limiter* limiter, LimiterOutcome outcome, u64 latency, u64 retry_after) {
+    u64 now = SysGetMonotonicTimeMs();
+
+    SysMutexLock (limiter->lock);
+    if (limiter->inflight) {
+        limiter->inflight--;
+    }
+
+    switch (outcome) {
+        case LIMITER_OUTCOME_THROTTLED : {
+            u64 wait             = retry_after ? retry_after : LIMITER_DEFAULT_RETRY_AFTER_MS;
+            u64 until            = now + wait;
+            limiter->retry_until = until > limiter->retry_until ? until : limiter->retry_until;
+
+            // bucket starts filling only once server is willing to take requests again
+            limiter->tokens      = 0;
+            limiter->refilled_at = limiter->retry_until;
+            Decrease (limiter, LIMITER_THROTTLE_DECREASE, now, latency);
+            break;
+        }
+
+        case LIMITER_OUTCOME_SUCCESS : {
+            if (Observe (limiter, latency)) {
+                Decrease (limiter, LIMITER_LATENCY_DECREASE, now, latency);
+            } else {
+                Increase (limiter);
+            }
+            break;
+        }
+
+        default :
+            break;
+    }
+
+    void (*wake) (void* ctx) = limiter->wake;
+    void* wake_ctx           = limiter->wake_ctx;
+
+    SysCondBroadcast (limiter->cond);
+    SysMutexUnlock (limiter->lock);
+
+    if (wake) {
+        wake (wake_ctx);
+    }
+}
+
+size LimiterGetLimit (Limiter* limiter) {
+    SysMutexLock (limiter->lock);
+    size limit = (size)limiter->limit;
+    SysMutexUnlock (limiter->lock);
+
+    return limit;
+}
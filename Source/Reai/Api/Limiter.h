@@ -0,0 +1,98 @@
+/**
+ * @file Limiter.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Per-connection admission control. Combines a token bucket (requests per second)
+ *    with an AIMD (additive increase, multiplicative decrease) concurrency limit driven
+ *    by observed latency and HTTP 429 responses.
+ *    Private to the transport, not installed.
+ * */
+
+#ifndef REAI_API_LIMITER_H
+#define REAI_API_LIMITER_H
+
+#include <Reai/Types.h>
+
+/// Max times a request answered with HTTP 429 is retried.
+#define LIMITER_MAX_RETRIES 5
+
+/// Returned as wait time when only a finishing request can let next one in.
+#define LIMITER_WAIT_FOREVER ((u64)-1)
+
+/// Longest a caller that must notice its deadline sleeps between admission attempts.
+#define LIMITER_POLL_MS 10
+
+typedef struct Limiter Limiter;
+
+typedef enum LimiterOutcome {
+    LIMITER_OUTCOME_SUCCESS,   /**< @b Request completed. */
+    LIMITER_OUTCOME_FAILURE,   /**< @b Transport failure, says nothing about server load. */
+    LIMITER_OUTCOME_THROTTLED, /**< @b Server answered with HTTP 429. */
+} LimiterOutcome;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Create a limiter.
+    ///
+    /// rate[in]            : Max requests started per second. 0 means unlimited.
+    /// adaptive[in]        : Adapt concurrency limit to server load, instead of fixing it
+    ///                       at `max_concurrency`.
+    /// max_concurrency[in] : Upper bound of concurrency limit.
+    ///
+    /// SUCCESS : New limiter.
+    /// FAILURE : Does not return.
+    ///
+    Limiter* LimiterCreate (u32 rate, bool adaptive, size max_concurrency);
+
+    ///
+    /// Destroy limiter. No request may be waiting on it.
+    ///
+    void LimiterDestroy (Limiter* limiter);
+
+    ///
+    /// Set function called whenever a request leaves the limiter, so a waiter that
+    /// can't block on the limiter itself gets a chance to retry admission.
+    ///
+    void LimiterSetWakeup (Limiter* limiter, void (*wake) (void* ctx), void* ctx);
+
+    ///
+    /// Try to admit a request without blocking.
+    ///
+    /// wait[out] : Milliseconds after which admission may succeed, if it did not now.
+    ///             `LIMITER_WAIT_FOREVER` if it depends on a running request completing.
+    ///
+    /// SUCCESS : true, and request must be released with `LimiterRelease`.
+    /// FAILURE : false
+    ///
+    bool LimiterTryAcquire (Limiter* limiter, u64* wait);
+
+    ///
+    /// Admit a request, blocking until it's allowed in.
+    /// Request must be released with `LimiterRelease`.
+    ///
+    void LimiterAcquire (Limiter* limiter);
+
+    ///
+    /// Report completion of an admitted request, and adapt limits to its outcome.
+    ///
+    /// outcome[in]     : How request ended.
+    /// latency[in]     : Milliseconds from admission to completion.
+    /// retry_after[in] : Milliseconds server asked to wait before retrying. 0 if not given.
+    ///
+    void LimiterRelease (Limiter* limiter, LimiterOutcome outcome, u64 latency, u64 retry_after);
+
+    ///
+    /// Get current concurrency limit.
+    ///
+    size LimiterGetLimit (Limiter* limiter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_API_LIMITER_H
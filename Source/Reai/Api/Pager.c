@@ -0,0 +1,306 @@
+/**
+ * @file Pager.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Page iterators, built on asynchronous variants of paginated API calls.
+ * */
+
+#include <Reai/Api.h>
+#include <Reai/Log.h>
+
+typedef enum PageKind {
+    PAGE_KIND_ANALYSES = 0,
+    PAGE_KIND_BINARIES,
+    PAGE_KIND_COLLECTIONS,
+} PageKind;
+
+typedef union PageItems {
+    AnalysisInfos   analyses;
+    BinaryInfos     binaries;
+    CollectionInfos collections;
+} PageItems;
+
+///
+/// A page being fetched. Future writes its items into `items` when it completes.
+///
+typedef struct PageSlot {
+    ApiFuture* future;
+    PageItems  items;
+} PageSlot;
+
+struct PageIter {
+    Connection* conn;
+    PageKind    kind;
+
+    /// Shallow copy of caller's request, with page (or offset) advanced for every page.
+    union {
+        RecentAnalysisRequest   analyses;
+        SearchBinaryRequest     binaries;
+        SearchCollectionRequest collections;
+    } request;
+
+    size first;     /**< @b Page (or offset) iteration started at. */
+    size page_size; /**< @b Items in a full page. */
+    size prefetch;  /**< @b Pages kept in flight. */
+
+    /// Ring of pages in flight, page `i` is in slot `i % prefetch`.
+    PageSlot slots[PAGE_ITER_MAX_PREFETCH];
+    size     requested; /**< @b Pages submitted so far. */
+    size     consumed;  /**< @b Pages taken out of ring so far. */
+
+    PageItems current;  /**< @b Page being walked through. */
+    size      position; /**< @b Next item of `current` to hand out. */
+
+    bool last;   /**< @b Last page has been taken out of ring, nothing more is fetched. */
+    bool failed; /**< @b A page failed to download. */
+};
+
+static size PageLength (PageIter* it, PageItems* items) {
+    switch (it->kind) {
+        case PAGE_KIND_ANALYSES :
+            return items->analyses.length;
+        case PAGE_KIND_BINARIES :
+            return items->binaries.length;
+        default :
+            return items->collections.length;
+    }
+}
+
+static void PageDeinit (PageIter* it, PageItems* items) {
+    switch (it->kind) {
+        case PAGE_KIND_ANALYSES :
+            VecDeinit (&items->analyses);
+            break;
+        case PAGE_KIND_BINARIES :
+            VecDeinit (&items->binaries);
+            break;
+        default :
+            VecDeinit (&items->collections);
+            break;
+    }
+}
+
+///
+/// Keep `prefetch` pages in flight, unless end of results has been reached.
+/// A page that could not be submitted has a NULL future, and fails iteration once reached.
+///
+static void PageIterFill (PageIter* it) {
+    while (!it->last && it->requested - it->consumed < it->prefetch) {
+        size      page = it->requested++;
+        PageSlot* slot = &it->slots[page % it->prefetch];
+        slot->items    = (PageItems) {0};
+
+        switch (it->kind) {
+            case PAGE_KIND_ANALYSES :
+                it->request.analyses.offset = it->first + page * it->page_size;
+                slot->future                = GetRecentAnalysisAsync (
+                    it->conn,
+                    &it->request.analyses,
+                    &slot->items.analyses,
+                    NULL,
+                    NULL
+                );
+                break;
+
+            case PAGE_KIND_BINARIES :
+                it->request.binaries.page = it->first + page;
+                slot->future              = SearchBinaryAsync (
+                    it->conn,
+                    &it->request.binaries,
+                    &slot->items.binaries,
+                    NULL,
+                    NULL
+                );
+                break;
+
+            default :
+                it->request.collections.page = it->first + page;
+                slot->future                 = SearchCollectionAsync (
+                    it->conn,
+                    &it->request.collections,
+                    &slot->items.collections,
+                    NULL,
+                    NULL
+                );
+                break;
+        }
+    }
+}
+
+///
+/// Replace current page with next one, waiting for it to arrive if it's still being fetched.
+///
+/// SUCCESS : true, `current` has at least one item.
+/// FAILURE : false, iteration is over.
+///
+static bool PageIterAdvance (PageIter* it) {
+    PageDeinit (it, &it->current);
+    it->position = 0;
+
+    if (it->last || it->consumed == it->requested) {
+        return false;
+    }
+
+    PageSlot* slot = &it->slots[it->consumed++ % it->prefetch];
+    bool      ok   = slot->future && ApiFutureWait (slot->future);
+    ApiFutureRelease (slot->future);
+    slot->future = NULL;
+    it->current  = slot->items;
+    slot->items  = (PageItems) {0};
+
+    if (!ok) {
+        LOG_ERROR ("Failed to get page %zu of results.", (size_t)(it->consumed - 1));
+        it->failed = true;
+        it->last   = true;
+        return false;
+    }
+
+    // a short page is the last one, pages fetched after it are past the end
+    size length = PageLength (it, &it->current);
+    if (length < it->page_size) {
+        it->last = true;
+    } else {
+        PageIterFill (it);
+    }
+
+    return length > 0;
+}
+
+///
+/// Move to next item, fetching next page if current one is used up.
+///
+/// SUCCESS : Index of item in `current`.
+/// FAILURE : -1 once iteration is over.
+///
+static i64 PageIterStep (PageIter* it, PageKind kind) {
+    if (!it || it->kind != kind) {
+        LOG_ERROR ("Invalid arguments.");
+        return -1;
+    }
+
+    while (it->position >= PageLength (it, &it->current)) {
+        if (!PageIterAdvance (it)) {
+            return -1;
+        }
+    }
+
+    return (i64)it->position++;
+}
+
+static PageIter* PageIterCreate (Connection* conn, PageKind kind, size prefetch) {
+    PageIter* it = NEW (PageIter);
+    if (!it) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    prefetch     = prefetch ? prefetch : PAGE_ITER_DEFAULT_PREFETCH;
+    it->conn     = conn;
+    it->kind     = kind;
+    it->prefetch = MIN2 (prefetch, PAGE_ITER_MAX_PREFETCH);
+    return it;
+}
+
+PageIter* PageIterCreateRecentAnalysis (
+    Connection*            conn,
+    RecentAnalysisRequest* request,
+    size                   prefetch
+) {
+    if (!conn || !request) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    PageIter* it = PageIterCreate (conn, PAGE_KIND_ANALYSES, prefetch);
+
+    // request builder clamps limit the same way
+    it->request.analyses       = *request;
+    it->request.analyses.limit = CLAMP (request->limit, 5, 50);
+    it->page_size              = it->request.analyses.limit;
+    it->first                  = request->offset;
+
+    PageIterFill (it);
+    return it;
+}
+
+PageIter*
+    PageIterCreateSearchBinary (Connection* conn, SearchBinaryRequest* request, size prefetch) {
+    if (!conn || !request || !request->page_size) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    PageIter* it         = PageIterCreate (conn, PAGE_KIND_BINARIES, prefetch);
+    it->request.binaries = *request;
+    it->page_size        = request->page_size;
+    it->first            = request->page;
+
+    PageIterFill (it);
+    return it;
+}
+
+PageIter* PageIterCreateSearchCollection (
+    Connection*              conn,
+    SearchCollectionRequest* request,
+    size                     prefetch
+) {
+    if (!conn || !request || !request->page_size) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    PageIter* it            = PageIterCreate (conn, PAGE_KIND_COLLECTIONS, prefetch);
+    it->request.collections = *request;
+    it->page_size           = request->page_size;
+    it->first               = request->page;
+
+    PageIterFill (it);
+    return it;
+}
+
+AnalysisInfo* PageIterNextAnalysis (PageIter* it) {
+    i64 idx = PageIterStep (it, PAGE_KIND_ANALYSES);
+    return idx < 0 ? NULL : VecPtrAt (&it->current.analyses, idx);
+}
+
+BinaryInfo* PageIterNextBinary (PageIter* it) {
+    i64 idx = PageIterStep (it, PAGE_KIND_BINARIES);
+    return idx < 0 ? NULL : VecPtrAt (&it->current.binaries, idx);
+}
+
+CollectionInfo* PageIterNextCollection (PageIter* it) {
+    i64 idx = PageIterStep (it, PAGE_KIND_COLLECTIONS);
+    return idx < 0 ? NULL : VecPtrAt (&it->current.collections, idx);
+}
+
+bool PageIterFailed (PageIter* it) {
+    return it && it->failed;
+}
+
+void PageIterDestroy (PageIter* it) {
+    if (!it) {
+        return;
+    }
+
+    // cancel everything first, so pages don't have to be waited for one by one
+    for (size page = it->consumed; page < it->requested; page++) {
+        PageSlot* slot = &it->slots[page % it->prefetch];
+        if (slot->future) {
+            ApiFutureCancel (slot->future);
+        }
+    }
+
+    // futures write into slots until they're done
+    for (size page = it->consumed; page < it->requested; page++) {
+        PageSlot* slot = &it->slots[page % it->prefetch];
+        if (slot->future) {
+            ApiFutureWait (slot->future);
+            ApiFutureRelease (slot->future);
+        }
+        PageDeinit (it, &slot->items);
+    }
+
+    PageDeinit (it, &it->current);
+    FREE (it);
+}
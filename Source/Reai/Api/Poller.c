@@ -0,0 +1,445 @@
+/**
+ * @file Poller.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include <Reai/Api.h>
+#include <Reai/Api/Poller.h>
+#include <Reai/Log.h>
+#include <Reai/Sys.h>
+
+typedef struct PollItem {
+    PollKind     kind;
+    u64          id;
+    PollCallback callback;
+    void*        user_data;
+
+    size       index;    /**< @b Position in `items` of poller. */
+    u64        added_at; /**< @b When tracking started. */
+    u64        due;      /**< @b When next poll is to be made. */
+    u32        attempts; /**< @b Polls that found item pending. */
+    u32        failures; /**< @b Consecutive polls that failed. */
+    Status     status;   /**< @b Written by poll in flight. */
+    ApiFuture* future;   /**< @b Poll in flight. Touched only by scheduler thread. */
+    Poller*    poller;
+} PollItem;
+
+typedef Vec (PollItem*) PollItems;
+
+struct Poller {
+    Connection*   conn;
+    PollerOptions options;
+    SysThread*    thread;
+
+    SysMutex* lock; /**< @b Guards everything below. */
+    SysCond*  wake; /**< @b Signalled for scheduler thread. */
+    SysCond*  idle; /**< @b Broadcast when `pending` drops to zero. */
+    PollItems items;   /**< @b Every tracked item, in no particular order. */
+    PollItems waiting; /**< @b Min-heap of items ordered by `due`. */
+    PollItems polled;  /**< @b Items whose poll completed, in order of completion. */
+    size      pending; /**< @b Tracked items whose callback hasn't returned yet. */
+    bool      stop;
+};
+
+static bool PollIsPending (PollKind kind, Status status) {
+    switch (status & STATUS_MASK) {
+        case STATUS_PROCESSING :
+            return true;
+
+        // analyses wait in queue before processing starts, decompilations are never queued
+        case STATUS_QUEUED :
+        case STATUS_UPLOADED :
+            return kind == POLL_KIND_ANALYSIS;
+
+        default :
+            return false;
+    }
+}
+
+///
+/// splitmix64 finalizer, good enough to jitter poll times with.
+///
+static u64 PollMix (u64 x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x  = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x  = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+u64 PollerBackoff (const PollerOptions* options, u32 attempt, u64 seed) {
+    PollerOptions defaults = PollerOptionsInit();
+    options                = options ? options : &defaults;
+
+    u32 shift = attempt ? attempt - 1 : 0;
+    u64 delay = options->initial_delay_ms << MIN2 (shift, 20);
+    delay     = MIN2 (delay, options->max_delay_ms);
+
+    u64 r = PollMix (seed ^ PollMix (((u64)attempt << 32) ^ SysGetMonotonicTimeMs()));
+    return delay - delay / 4 + r % (delay / 2 + 1);
+}
+
+static bool PollEarlier (PollItem* a, PollItem* b) {
+    return a->due < b->due;
+}
+
+static void HeapPush (PollItems* heap, PollItem* item) {
+    VecPushBack (heap, item);
+    for (size i = heap->length - 1; i;) {
+        size parent = (i - 1) / 2;
+        if (!PollEarlier (VecAt (heap, i), VecAt (heap, parent))) {
+            break;
+        }
+        VecSwapItems (heap, i, parent);
+        i = parent;
+    }
+}
+
+static PollItem* HeapPop (PollItems* heap) {
+    PollItem* top = VecAt (heap, 0);
+    VecSwapItems (heap, 0, heap->length - 1);
+    VecDeleteLast (heap);
+
+    for (size i = 0;;) {
+        size left     = 2 * i + 1;
+        size right    = left + 1;
+        size earliest = i;
+        if (left < heap->length && PollEarlier (VecAt (heap, left), VecAt (heap, earliest))) {
+            earliest = left;
+        }
+        if (right < heap->length && PollEarlier (VecAt (heap, right), VecAt (heap, earliest))) {
+            earliest = right;
+        }
+        if (earliest == i) {
+            break;
+        }
+        VecSwapItems (heap, i, earliest);
+        i = earliest;
+    }
+
+    return top;
+}
+
+///
+/// Stop tracking an item. Caller must hold lock, and invoke its callback afterwards.
+///
+static void PollerForget (Poller* poller, PollItem* item) {
+    PollItem* moved = VecAt (&poller->items, poller->items.length - 1);
+    moved->index    = item->index;
+    VecDeleteFast (&poller->items, item->index);
+}
+
+///
+/// Completion callback of a status poll, on engine thread (or scheduler thread for backends
+/// other than libcurl). Result is looked at by scheduler thread.
+///
+static void PollerOnStatus (ApiFuture* future, void* user_data) {
+    (void)future;
+    PollItem* item   = (PollItem*)user_data;
+    Poller*   poller = item->poller;
+
+    SysMutexLock (poller->lock);
+    VecPushBack (&poller->polled, item);
+    SysCondSignal (poller->wake);
+    SysMutexUnlock (poller->lock);
+}
+
+static void PollerSubmit (Poller* poller, PollItem* item) {
+    ApiFuture* future = NULL;
+    item->status      = STATUS_INVALID;
+
+    if (item->kind == POLL_KIND_ANALYSIS) {
+        future = GetAnalysisStatusAsync (
+            poller->conn,
+            item->id,
+            &item->status,
+            PollerOnStatus,
+            item
+        );
+    } else {
+        future = GetAiDecompilationStatusAsync (
+            poller->conn,
+            item->id,
+            &item->status,
+            PollerOnStatus,
+            item
+        );
+    }
+
+    // callback is never invoked for a poll that couldn't be submitted
+    if (!future) {
+        PollerOnStatus (NULL, item);
+    }
+    item->future = future;
+}
+
+///
+/// Look at result of a completed poll.
+///
+/// RETURN : true if item is done and its callback is to be invoked.
+///
+static bool PollerSettle (Poller* poller, PollItem* item, u64 now) {
+    // callback of a poll is invoked just before its future is marked done
+    bool succeeded = item->future && ApiFutureWait (item->future);
+    ApiFutureRelease (item->future);
+    item->future = NULL;
+
+    if (!succeeded || item->status == STATUS_INVALID) {
+        if (++item->failures >= POLLER_MAX_FAILURES) {
+            LOG_ERROR ("Giving up on %llu, status polls keep failing.", item->id);
+            item->status = STATUS_INVALID;
+            return true;
+        }
+    } else {
+        item->failures = 0;
+        if (!PollIsPending (item->kind, item->status)) {
+            return true;
+        }
+        item->attempts++;
+    }
+
+    if (poller->options.timeout_ms && now - item->added_at >= poller->options.timeout_ms) {
+        LOG_ERROR (
+            "Giving up on %llu, still pending after %llu ms.",
+            item->id,
+            now - item->added_at
+        );
+        item->status = STATUS_INVALID;
+        return true;
+    }
+
+    // a failed poll is retried after same backoff as a pending one
+    item->due   = now + PollerBackoff (&poller->options, MAX2 (item->attempts, 1), item->id);
+    HeapPush (&poller->waiting, item);
+    return false;
+}
+
+static void PollerRun (void* arg) {
+    Poller*   poller = (Poller*)arg;
+    PollItems due    = VecInit();
+    PollItems done   = VecInit();
+
+    SysMutexLock (poller->lock);
+    while (!poller->stop) {
+        u64 now = SysGetMonotonicTimeMs();
+
+        VecForeach (&poller->polled, item, {
+            if (PollerSettle (poller, item, now)) {
+                PollerForget (poller, item);
+                VecPushBack (&done, item);
+            }
+        });
+        VecClear (&poller->polled);
+
+        while (poller->waiting.length && VecAt (&poller->waiting, 0)->due <= now) {
+            VecPushBack (&due, HeapPop (&poller->waiting));
+        }
+
+        if (!due.length && !done.length) {
+            if (poller->waiting.length) {
+                SysCondWaitTimeout (
+                    poller->wake,
+                    poller->lock,
+                    VecAt (&poller->waiting, 0)->due - now
+                );
+            } else {
+                SysCondWait (poller->wake, poller->lock);
+            }
+            continue;
+        }
+
+        // polls of backends other than libcurl complete inline, and take the lock
+        SysMutexUnlock (poller->lock);
+
+        VecForeach (&due, item, { PollerSubmit (poller, item); });
+        VecClear (&due);
+
+        VecForeach (&done, item, {
+            item->callback (item->kind, item->id, item->status, item->user_data);
+            FREE (item);
+        });
+
+        SysMutexLock (poller->lock);
+        poller->pending -= done.length;
+        if (!poller->pending) {
+            SysCondBroadcast (poller->idle);
+        }
+        VecClear (&done);
+    }
+    SysMutexUnlock (poller->lock);
+
+    VecDeinit (&due);
+    VecDeinit (&done);
+}
+
+Poller* PollerCreate (Connection* conn, const PollerOptions* options) {
+    if (!conn) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    Poller* poller = NEW (Poller);
+    if (!poller) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    PollerOptions defaults = PollerOptionsInit();
+    poller->conn           = conn;
+    poller->options        = options ? *options : defaults;
+    poller->items          = (PollItems)VecInit();
+    poller->waiting        = (PollItems)VecInit();
+    poller->polled         = (PollItems)VecInit();
+
+    if (!poller->options.initial_delay_ms) {
+        poller->options.initial_delay_ms = 1;
+    }
+    poller->options.max_delay_ms = MAX2 (
+        poller->options.max_delay_ms,
+        poller->options.initial_delay_ms
+    );
+
+    poller->lock   = SysMutexCreate();
+    poller->wake   = SysCondCreate();
+    poller->idle   = SysCondCreate();
+    poller->thread = SysThreadCreate (PollerRun, poller);
+    if (!poller->lock || !poller->wake || !poller->idle || !poller->thread) {
+        LOG_ERROR ("Failed to start poller thread.");
+        PollerDestroy (poller);
+        return NULL;
+    }
+
+    return poller;
+}
+
+void PollerDestroy (Poller* poller) {
+    if (!poller) {
+        return;
+    }
+
+    if (poller->thread) {
+        SysMutexLock (poller->lock);
+        poller->stop = true;
+        SysCondSignal (poller->wake);
+        SysMutexUnlock (poller->lock);
+        SysThreadJoin (poller->thread);
+    }
+
+    // scheduler is gone, so nothing but the engine touches items now
+    VecForeach (&poller->items, item, {
+        if (item->future) {
+            ApiFutureCancel (item->future);
+        }
+    });
+    VecForeach (&poller->items, item, {
+        if (item->future) {
+            ApiFutureWait (item->future);
+            ApiFutureRelease (item->future);
+        }
+        item->callback (item->kind, item->id, STATUS_INVALID, item->user_data);
+        FREE (item);
+    });
+
+    VecDeinit (&poller->items);
+    VecDeinit (&poller->waiting);
+    VecDeinit (&poller->polled);
+
+    if (poller->idle) {
+        SysCondBroadcast (poller->idle);
+        SysCondDestroy (poller->idle);
+    }
+    if (poller->wake) {
+        SysCondDestroy (poller->wake);
+    }
+    if (poller->lock) {
+        SysMutexDestroy (poller->lock);
+    }
+    FREE (poller);
+}
+
+static bool
+    PollerAdd (Poller* poller, PollKind kind, u64 id, PollCallback callback, void* user_data) {
+    if (!poller || !id || !callback) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    PollItem* item = NEW (PollItem);
+    if (!item) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    item->poller    = poller;
+    item->kind      = kind;
+    item->id        = id;
+    item->callback  = callback;
+    item->user_data = user_data;
+    item->added_at  = SysGetMonotonicTimeMs();
+    item->due       = item->added_at;
+
+    SysMutexLock (poller->lock);
+    item->index = poller->items.length;
+    VecPushBack (&poller->items, item);
+    HeapPush (&poller->waiting, item);
+    poller->pending++;
+    SysCondSignal (poller->wake);
+    SysMutexUnlock (poller->lock);
+
+    return true;
+}
+
+bool PollerAddAnalysis (
+    Poller*      poller,
+    BinaryId     binary_id,
+    PollCallback callback,
+    void*        user_data
+) {
+    return PollerAdd (poller, POLL_KIND_ANALYSIS, binary_id, callback, user_data);
+}
+
+bool PollerAddAiDecompilation (
+    Poller*      poller,
+    FunctionId   function_id,
+    PollCallback callback,
+    void*        user_data
+) {
+    return PollerAdd (poller, POLL_KIND_AI_DECOMPILATION, function_id, callback, user_data);
+}
+
+size PollerPending (Poller* poller) {
+    if (!poller) {
+        return 0;
+    }
+
+    SysMutexLock (poller->lock);
+    size pending = poller->pending;
+    SysMutexUnlock (poller->lock);
+    return pending;
+}
+
+bool PollerWait (Poller* poller, u64 timeout_ms) {
+    if (!poller) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    u64 deadline = SysGetMonotonicTimeMs() + timeout_ms;
+
+    SysMutexLock (poller->lock);
+    while (poller->pending) {
+        if (!timeout_ms) {
+            SysCondWait (poller->idle, poller->lock);
+            continue;
+        }
+
+        u64 now = SysGetMonotonicTimeMs();
+        if (now >= deadline) {
+            break;
+        }
+        SysCondWaitTimeout (poller->idle, poller->lock, deadline - now);
+    }
+    bool idle = !poller->pending;
+    SysMutexUnlock (poller->lock);
+
+    return idle;
+}
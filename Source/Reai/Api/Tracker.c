@@ -0,0 +1,320 @@
+/**
+ * @file Tracker.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Bulk tracking of analysis completion, built on page iterators over recent analyses.
+ * */
+
+#include <Reai/Api.h>
+#include <Reai/Log.h>
+#include <Reai/Sys.h>
+
+// libc
+#include <stdlib.h>
+
+typedef struct TrackedAnalysis {
+    BinaryId   binary_id;
+    AnalysisId analysis_id;
+    Status     status;
+    u64        added_at;
+    bool       seen; /**< @b Status got refreshed in current round. */
+} TrackedAnalysis;
+
+typedef Vec (TrackedAnalysis) TrackedAnalyses;
+typedef Vec (AnalysisEvent) AnalysisEvents;
+typedef Vec (ApiFuture*) ApiFutures;
+typedef Vec (Status) Statuses;
+
+struct AnalysisTracker {
+    Connection*     conn;
+    Workspace       workspace; /**< @b Where recent analyses are looked through. */
+    PollerOptions   options;
+    TrackedAnalyses items;      /**< @b Pending analyses, sorted by binary id unless `unsorted`. */
+    bool            unsorted;   /**< @b Binaries were added since last sort. */
+    AnalysisEvents  events;     /**< @b Completions not taken out yet, from `next_event` on. */
+    size            next_event;
+    u64             refreshed_at; /**< @b When last refresh was made. 0 if never. */
+    u32             idle_rounds;  /**< @b Refreshes in a row that found nothing done. */
+};
+
+static bool AnalysisIsPending (Status status) {
+    switch (status & STATUS_MASK) {
+        case STATUS_QUEUED :
+        case STATUS_UPLOADED :
+        case STATUS_PROCESSING :
+            return true;
+        default :
+            return false;
+    }
+}
+
+static int CompareTracked (const void* a, const void* b) {
+    BinaryId x = ((const TrackedAnalysis*)a)->binary_id;
+    BinaryId y = ((const TrackedAnalysis*)b)->binary_id;
+    return x < y ? -1 : x > y;
+}
+
+///
+/// Sort tracked binaries so they can be looked up, and drop ones added more than once.
+///
+static void TrackerSort (AnalysisTracker* tracker) {
+    if (!tracker->unsorted) {
+        return;
+    }
+
+    TrackedAnalyses* items = &tracker->items;
+    VecSort (items, CompareTracked);
+
+    size kept = 0;
+    VecForeachIdx (items, item, idx, {
+        if (!kept || VecAt (items, kept - 1).binary_id != item.binary_id) {
+            VecAt (items, kept++) = item;
+        }
+    });
+    VecResize (items, kept);
+    tracker->unsorted = false;
+}
+
+static TrackedAnalysis* TrackerFind (AnalysisTracker* tracker, BinaryId binary_id) {
+    TrackedAnalysis key = {.binary_id = binary_id};
+    return bsearch (
+        &key,
+        tracker->items.data,
+        tracker->items.length,
+        sizeof (TrackedAnalysis),
+        CompareTracked
+    );
+}
+
+///
+/// Look through recent analyses for tracked binaries, newest first.
+///
+/// RETURN : Number of pending binaries not seen among them.
+///
+static size TrackerScan (AnalysisTracker* tracker, bool* failed) {
+    size                  unseen  = tracker->items.length;
+    RecentAnalysisRequest request = RecentAnalysisRequestInit();
+    request.workspace             = tracker->workspace;
+
+    // fewer binaries than a page holds are cheaper to poll one by one than to look for
+    if (unseen < request.limit) {
+        RecentAnalysisRequestDeinit (&request);
+        return unseen;
+    }
+
+    PageIter* it = PageIterCreateRecentAnalysis (tracker->conn, &request, 0);
+
+    if (it) {
+        AnalysisInfo* info    = NULL;
+        size          scanned = 0;
+        while (unseen && scanned++ < ANALYSIS_TRACKER_MAX_SCAN &&
+               (info = PageIterNextAnalysis (it))) {
+            TrackedAnalysis* item = TrackerFind (tracker, info->binary_id);
+
+            // a binary analysed more than once shows up again in older analyses
+            if (!item || item->seen) {
+                continue;
+            }
+
+            item->seen        = true;
+            item->analysis_id = info->analysis_id;
+            item->status      = info->status;
+            unseen--;
+        }
+        *failed = PageIterFailed (it);
+    } else {
+        *failed = true;
+    }
+
+    PageIterDestroy (it);
+    RecentAnalysisRequestDeinit (&request);
+    return unseen;
+}
+
+///
+/// Poll status of every binary not seen by scan, all at once.
+///
+static void TrackerPollStragglers (AnalysisTracker* tracker, size unseen, bool* failed) {
+    ApiFutures futures  = VecInit();
+    Statuses   statuses = VecInit();
+    VecReserve (&futures, unseen);
+    VecResize (&statuses, unseen);
+
+    // statuses don't move, they're reserved up front
+    VecForeachPtr (&tracker->items, item, {
+        if (!item->seen) {
+            Status* status = VecPtrAt (&statuses, futures.length);
+            *status        = STATUS_INVALID;
+            VecPushBack (
+                &futures,
+                GetAnalysisStatusAsync (tracker->conn, item->binary_id, status, NULL, NULL)
+            );
+        }
+    });
+
+    size next = 0;
+    VecForeachPtr (&tracker->items, item, {
+        if (!item->seen) {
+            ApiFuture* future = VecAt (&futures, next);
+            Status     status = VecAt (&statuses, next++);
+            if (future && ApiFutureWait (future) && status != STATUS_INVALID) {
+                item->seen   = true;
+                item->status = status;
+            } else {
+                *failed = true;
+            }
+            ApiFutureRelease (future);
+        }
+    });
+
+    VecDeinit (&futures);
+    VecDeinit (&statuses);
+}
+
+AnalysisTracker*
+    AnalysisTrackerCreate (Connection* conn, Workspace workspace, const PollerOptions* options) {
+    if (!conn || workspace >= WORKSPACE_MAX) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    AnalysisTracker* tracker = NEW (AnalysisTracker);
+    if (!tracker) {
+        LOG_FATAL ("Failed to allocate memory.");
+    }
+
+    PollerOptions defaults = PollerOptionsInit();
+    tracker->conn          = conn;
+    tracker->workspace     = workspace;
+    tracker->options       = options ? *options : defaults;
+    tracker->items         = (TrackedAnalyses)VecInit();
+    tracker->events        = (AnalysisEvents)VecInit();
+    return tracker;
+}
+
+void AnalysisTrackerDestroy (AnalysisTracker* tracker) {
+    if (!tracker) {
+        return;
+    }
+
+    VecDeinit (&tracker->items);
+    VecDeinit (&tracker->events);
+    FREE (tracker);
+}
+
+bool AnalysisTrackerAdd (AnalysisTracker* tracker, BinaryId binary_id) {
+    if (!tracker || !binary_id) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    TrackedAnalysis item = {
+        .binary_id = binary_id,
+        .status    = STATUS_INVALID,
+        .added_at  = SysGetMonotonicTimeMs(),
+    };
+    VecPushBack (&tracker->items, item);
+    tracker->unsorted = true;
+    return true;
+}
+
+size AnalysisTrackerPending (AnalysisTracker* tracker) {
+    if (!tracker) {
+        return 0;
+    }
+
+    TrackerSort (tracker);
+    return tracker->items.length;
+}
+
+bool AnalysisTrackerRefresh (AnalysisTracker* tracker) {
+    if (!tracker) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    TrackerSort (tracker);
+    tracker->refreshed_at = SysGetMonotonicTimeMs();
+    if (!tracker->items.length) {
+        return true;
+    }
+
+    VecForeachPtr (&tracker->items, item, { item->seen = false; });
+
+    bool failed = false;
+    size unseen = TrackerScan (tracker, &failed);
+    if (unseen) {
+        TrackerPollStragglers (tracker, unseen, &failed);
+    }
+
+    // move finished analyses out, keeping rest in order
+    u64  now     = SysGetMonotonicTimeMs();
+    u64  timeout = tracker->options.timeout_ms;
+    size kept    = 0;
+    size events  = tracker->events.length;
+    VecForeachPtr (&tracker->items, item, {
+        bool done = item->seen && !AnalysisIsPending (item->status);
+        if (!done && timeout && now - item->added_at >= timeout) {
+            LOG_ERROR ("Giving up on analysis of binary %llu, still pending.", item->binary_id);
+            item->status = STATUS_INVALID;
+            done         = true;
+        }
+
+        if (done) {
+            AnalysisEvent event = {0};
+            event.binary_id     = item->binary_id;
+            event.analysis_id   = item->analysis_id;
+            event.status        = item->status;
+            VecPushBack (&tracker->events, event);
+        } else {
+            VecAt (&tracker->items, kept++) = *item;
+        }
+    });
+    VecResize (&tracker->items, kept);
+
+    tracker->idle_rounds = tracker->events.length > events ? 0 : tracker->idle_rounds + 1;
+    return !failed;
+}
+
+bool AnalysisTrackerNext (AnalysisTracker* tracker, AnalysisEvent* event) {
+    if (!tracker || !event) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    while (tracker->next_event == tracker->events.length) {
+        VecClear (&tracker->events);
+        tracker->next_event = 0;
+
+        if (!AnalysisTrackerPending (tracker)) {
+            return false;
+        }
+
+        // back off from last refresh, noticing cancellation meanwhile
+        if (tracker->refreshed_at) {
+            u64 wait = PollerBackoff (
+                &tracker->options,
+                MAX2 (tracker->idle_rounds, 1),
+                (u64)(size_t)tracker
+            );
+            u64 until = tracker->refreshed_at + wait;
+            for (u64 now = SysGetMonotonicTimeMs();
+                 now < until && !RequestOptionsExpired (tracker->conn->options);
+                 now = SysGetMonotonicTimeMs()) {
+                SysSleepMs (MIN2 (until - now, 50));
+            }
+        }
+
+        if (RequestOptionsExpired (tracker->conn->options)) {
+            LOG_ERROR ("Gave up waiting for analyses, call got cancelled or timed out.");
+            return false;
+        }
+
+        AnalysisTrackerRefresh (tracker);
+    }
+
+    *event = VecAt (&tracker->events, tracker->next_event++);
+    return true;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file Transport.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Private interface shared between the blocking and asynchronous transports.
+ *    Not installed, and not part of the public API.
+ * */
+
+#ifndef REAI_API_TRANSPORT_H
+#define REAI_API_TRANSPORT_H
+
+#include <Reai/Api/Connection.h>
+#include <Reai/Sys.h>
+#include <Reai/Util/JsonStream.h>
+#include <Reai/Util/Vec.h>
+
+#include "Limiter.h"
+
+/* libCURL */
+#include <curl/curl.h>
+
+/* libc */
+#include <stdio.h>
+
+typedef Vec (CURL*) CurlHandles;
+
+/// Larger `Content-Length` values are not trusted for reserving response buffer up front.
+#define TRANSFER_MAX_PRESIZE (256 * 1024 * 1024)
+
+/// Time limits of a single request. Uploads are not bound by `TRANSFER_TIMEOUT_MS`.
+/// Time left until deadline of the call (capped to fit a `long`) shortens both.
+#define TRANSFER_TIMEOUT_MS         30000
+#define TRANSFER_CONNECT_TIMEOUT_MS 10000
+#define TRANSFER_MAX_TIMEOUT_MS     0x7fffffff
+
+/// Wait before first restart of an interrupted upload, doubled for every next one.
+#define TRANSFER_UPLOAD_BACKOFF_MS     1000
+#define TRANSFER_UPLOAD_MAX_BACKOFF_MS 16000
+
+typedef struct AsyncEngine AsyncEngine;
+
+struct ConnectionPool {
+    SysMutex*       lock;
+    CurlHandles     idle;
+    Strs            buffers; /**< @b Idle string buffers, cleared but with capacity retained. */
+    ConnectionStats stats;
+    AsyncEngine*    engine; /**< @b Created on first async request. */
+    Limiter*        limiter; /**< @b Admission control, NULL if disabled. */
+};
+
+///
+/// Per-connection settings applied to every transfer made over it.
+///
+typedef struct TransferOptions {
+    Str* ca_bundle;      /**< @b May be NULL or empty to use system default. */
+    bool http2;          /**< @b Negotiate HTTP/2 and wait for a connection to multiplex over. */
+    size compress_above; /**< @b Gzip JSON bodies larger than this many bytes. 0 disables. */
+
+    size                   upload_chunk_size;    /**< @b 0 means default. */
+    u32                    upload_stall_timeout; /**< @b Seconds. 0 means default. */
+    UploadProgressCallback upload_progress;
+    void*                  upload_progress_data;
+} TransferOptions;
+
+///
+/// State of a single transfer that must stay alive until the transfer completes.
+///
+typedef struct Transfer {
+    CURL*              curl;
+    Str*               response;    /**< @b Where response is written. */
+    Str                my_response; /**< @b Used when caller does not need the response. */
+    Str                packed_body; /**< @b Compressed request body, if any. */
+    JsonStream*        stream;      /**< @b If not NULL, response is fed here instead. */
+    struct curl_slist* headers;
+    curl_mime*         mime;
+    bool               failed;      /**< @b Set by `TransferFinish`. */
+    bool               abandoned;   /**< @b Cancelled because a hedged copy won. Not counted. */
+    bool               throttled;   /**< @b Server answered with HTTP 429. */
+    u64                retry_after; /**< @b Milliseconds from `Retry-After` header, 0 if none. */
+    bool               tls_checked; /**< @b TLS session state has been looked at. */
+    bool               tls_resumed; /**< @b TLS handshake resumed a cached session. */
+    u64                body_size;   /**< @b Size of JSON body before compression. */
+    u64                received;    /**< @b Response bytes after decompression. */
+    TransferBytes      bytes;       /**< @b Filled by `ConnectionPoolRelease`. */
+
+    // file upload, if any
+    FILE*                  upload_file;
+    const u8*              upload_data;   /**< @b Uploaded from memory instead of a file. */
+    u64                    upload_offset; /**< @b Bytes of `upload_data` handed to CURL so far. */
+    UploadProgress         upload;         /**< @b Caller sets `retries` after setup. */
+    u64                    upload_started; /**< @b When transfer was set up. */
+    u64                    chunk_started;  /**< @b When last chunk was handed to CURL. */
+    UploadProgressCallback upload_progress;
+    void*                  upload_progress_data;
+    bool                   interrupted; /**< @b Upload failed midway, and may be restarted. */
+
+    RequestOptions call; /**< @b Deadline and cancellation of the call transfer belongs to. */
+} Transfer;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Make a request over libcurl, blocking until done. Goes through async engine of the
+    /// connection when it multiplexes or hedges, and over a pooled handle otherwise.
+    /// Options of the connection are not looked at, those of the request are.
+    ///
+    /// SUCCESS : true, with response body in `response_json` (if not NULL).
+    /// FAILURE : false, and `response_json` is deinited.
+    ///
+    bool ConnectionPerformCurl (Connection* conn, ApiRequest* request, Str* response_json);
+
+    ///
+    /// Check whether given backend of a connection is libcurl. NULL is.
+    ///
+    bool ApiBackendIsCurl (ApiBackend* backend);
+
+    ///
+    /// Make a request over given backend, blocking until done. Splits streamed array
+    /// out of the response, since backends always produce complete response bodies.
+    ///
+    /// SUCCESS : true, with response body in `response` (if not NULL).
+    /// FAILURE : false, and `response` is deinited.
+    ///
+    bool ApiBackendDispatch (
+        ApiBackend* backend,
+        Connection* conn,
+        ApiRequest* request,
+        Str*        response
+    );
+
+    ///
+    /// Get name of uploaded file given its path.
+    ///
+    const char* FileBaseName (Str* file_path);
+
+    ///
+    /// Get pool of given connection, creating one if it does not exist already.
+    /// Multiple threads may race to create the pool, only one of them wins.
+    ///
+    ConnectionPool* ConnectionPoolGet (Connection* conn);
+
+    ///
+    /// Destroy pool, its async engine (if any) and all idle handles.
+    ///
+    void ConnectionPoolDestroy (ConnectionPool* pool);
+
+    ///
+    /// Take an idle handle from pool, or create a new one if pool is empty.
+    ///
+    /// SUCCESS : A CURL handle in reset state.
+    /// FAILURE : `NULL`
+    ///
+    CURL* ConnectionPoolAcquire (ConnectionPool* pool);
+
+    ///
+    /// Record stats of finished transfer into `xfer->bytes` and pool stats,
+    /// then reset and give back a handle to the pool.
+    /// If pool already holds `max_idle` handles, given handle is destroyed instead.
+    ///
+    /// xfer[in] : Finished transfer made on `curl`, or NULL if handle could not be
+    ///            used for a transfer at all (counted as a failed request).
+    ///            Abandoned transfers are not counted at all.
+    ///
+    void ConnectionPoolRelease (ConnectionPool* pool, CURL* curl, size max_idle, Transfer* xfer);
+
+    ///
+    /// Get outcome of a transfer finished with `TransferFinish`, to report to admission control.
+    ///
+    LimiterOutcome TransferOutcome (Transfer* xfer);
+
+    ///
+    /// Check whether request may be sent more than once. Only plain GET requests qualify.
+    /// Streamed requests don't, since their elements would be read twice.
+    ///
+    bool ApiRequestIsHedgeable (ApiRequest* req);
+
+    ///
+    /// Get wait before restarting an interrupted upload that has been restarted `retries` times.
+    ///
+    u64 TransferUploadBackoff (u32 retries);
+
+    ///
+    /// Take an idle buffer from pool, or an empty one if pool has none.
+    ///
+    Str ConnectionPoolAcquireBuffer (ConnectionPool* pool);
+
+    ///
+    /// Clear and give back a buffer to the pool, keeping its capacity.
+    /// If pool already holds `max_idle` buffers, or buffer is too large, it's freed instead.
+    /// Given buffer is left empty either way.
+    ///
+    void ConnectionPoolReleaseBuffer (ConnectionPool* pool, size max_idle, Str* buf);
+
+    ///
+    /// Set all options required to perform a request on given handle.
+    /// If `stream` is not NULL, response is split by it as it arrives, and only the envelope
+    /// ends up in `response_json`. Stream is owned by caller and must outlive the transfer.
+    /// If `upload_data` is not NULL, it's uploaded in place of file at `file_path`, which then
+    /// only names it. Data is owned by caller and must outlive the transfer.
+    /// Transfer is aborted once `call` (may be NULL) expires, and fails right away if it already has.
+    /// With `opts->http2` set, handle waits for an existing connection it can multiplex over
+    /// instead of opening a new one, which only helps when driven by a multi handle.
+    /// On success `TransferFinish` must be called once the transfer completes.
+    ///
+    /// SUCCESS : true
+    /// FAILURE : false, and nothing needs to be cleaned up.
+    ///
+    bool TransferSetup (
+        Transfer*              xfer,
+        CURL*                  curl,
+        Str*                   user_agent,
+        Str*                   api_key,
+        Str*                   request_url,
+        Str*                   request_json,
+        Str*                   response_json,
+        const char*            request_method,
+        Str*                   file_path,
+        const void*            upload_data,
+        size                   upload_size,
+        JsonStream*            stream,
+        const RequestOptions*  call,
+        const TransferOptions* opts
+    );
+
+    ///
+    /// Release resources held by a transfer and report its result.
+    ///
+    /// SUCCESS : true if `retcode` is CURLE_OK.
+    /// FAILURE : false
+    ///
+    bool TransferFinish (Transfer* xfer, CURLcode retcode);
+
+    ///
+    /// Stop the engine thread and fail all pending and running requests.
+    ///
+    void AsyncEngineDestroy (AsyncEngine* engine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_API_TRANSPORT_H
@@ -21,7 +21,7 @@ bool ReadCompleteFile (const char *filename, char **data, size *file_size, size
 
     // allocate memory to hold the file contents if required
     char *buffer = *data;
-    if (*capacity < (u64)size) {
+    if (*capacity <= (u64)size) {
         buffer = realloc (buffer, size + 1);
         if (!buffer) {
             Str syserr;
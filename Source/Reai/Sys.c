@@ -31,6 +31,24 @@ struct SysMutex {
 #endif
 };
 
+struct SysCond {
+#ifdef _WIN32
+    CONDITION_VARIABLE cond;
+#else
+    pthread_cond_t cond;
+#endif
+};
+
+struct SysThread {
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    SysThreadFn fn;
+    void*       arg;
+};
+
 // Cross platform get current time
 Str* SysGetLocalTime (Str* timebuf) {
     // Get the current time
@@ -196,6 +214,184 @@ SysMutex* SysMutexUnlock (SysMutex* m) {
     return m;
 }
 
+void* SysAtomicCasPtr (void* volatile* dst, void* expected, void* desired) {
+    if (!dst) {
+        LOG_FATAL ("Invalid arguments.");
+    }
+#ifdef _WIN32
+    return InterlockedCompareExchangePointer ((PVOID volatile*)dst, desired, expected);
+#else
+    return __sync_val_compare_and_swap (dst, expected, desired);
+#endif
+}
+
+SysCond* SysCondCreate() {
+    SysCond* c = NEW (SysCond);
+    if (!c) {
+        LOG_ERROR ("Failed to allocate memory.");
+        return NULL;
+    }
+#ifdef _WIN32
+    InitializeConditionVariable (&c->cond);
+#else
+    pthread_condattr_t attr;
+    pthread_condattr_init (&attr);
+#    ifndef __APPLE__
+    pthread_condattr_setclock (&attr, CLOCK_MONOTONIC);
+#    endif
+    pthread_cond_init (&c->cond, &attr);
+    pthread_condattr_destroy (&attr);
+#endif
+    return c;
+}
+
+void SysCondDestroy (SysCond* c) {
+    if (!c) {
+        return;
+    }
+#ifndef _WIN32
+    pthread_cond_destroy (&c->cond);
+#endif
+    memset (c, 0, sizeof (SysCond));
+    FREE (c);
+}
+
+SysCond* SysCondWait (SysCond* c, SysMutex* m) {
+    if (!c || !m) {
+        return NULL;
+    }
+#ifdef _WIN32
+    SleepConditionVariableCS (&c->cond, &m->lock, INFINITE);
+#else
+    pthread_cond_wait (&c->cond, &m->lock);
+#endif
+    return c;
+}
+
+bool SysCondWaitTimeout (SysCond* c, SysMutex* m, u64 timeout_ms) {
+    if (!c || !m) {
+        return false;
+    }
+#ifdef _WIN32
+    return SleepConditionVariableCS (&c->cond, &m->lock, (DWORD)timeout_ms);
+#else
+    struct timespec ts;
+#    ifdef __APPLE__
+    clock_gettime (CLOCK_REALTIME, &ts);
+#    else
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+#    endif
+    ts.tv_sec  += timeout_ms / 1000;
+    ts.tv_nsec += (timeout_ms % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+    return !pthread_cond_timedwait (&c->cond, &m->lock, &ts);
+#endif
+}
+
+void SysCondSignal (SysCond* c) {
+    if (!c) {
+        return;
+    }
+#ifdef _WIN32
+    WakeConditionVariable (&c->cond);
+#else
+    pthread_cond_signal (&c->cond);
+#endif
+}
+
+void SysCondBroadcast (SysCond* c) {
+    if (!c) {
+        return;
+    }
+#ifdef _WIN32
+    WakeAllConditionVariable (&c->cond);
+#else
+    pthread_cond_broadcast (&c->cond);
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI SysThreadEntry (LPVOID arg) {
+    SysThread* t = (SysThread*)arg;
+    t->fn (t->arg);
+    return 0;
+}
+#else
+static void* SysThreadEntry (void* arg) {
+    SysThread* t = (SysThread*)arg;
+    t->fn (t->arg);
+    return NULL;
+}
+#endif
+
+SysThread* SysThreadCreate (SysThreadFn fn, void* arg) {
+    if (!fn) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    SysThread* t = NEW (SysThread);
+    if (!t) {
+        LOG_ERROR ("Failed to allocate memory.");
+        return NULL;
+    }
+
+    t->fn  = fn;
+    t->arg = arg;
+
+#ifdef _WIN32
+    t->handle = CreateThread (NULL, 0, SysThreadEntry, t, 0, NULL);
+    if (!t->handle) {
+        LOG_ERROR ("Failed to create thread.");
+        FREE (t);
+        return NULL;
+    }
+#else
+    if (pthread_create (&t->handle, NULL, SysThreadEntry, t)) {
+        LOG_ERROR ("Failed to create thread.");
+        FREE (t);
+        return NULL;
+    }
+#endif
+
+    return t;
+}
+
+void SysThreadJoin (SysThread* t) {
+    if (!t) {
+        return;
+    }
+#ifdef _WIN32
+    WaitForSingleObject (t->handle, INFINITE);
+    CloseHandle (t->handle);
+#else
+    pthread_join (t->handle, NULL);
+#endif
+    FREE (t);
+}
+
+u64 SysGetMonotonicTimeMs() {
+#ifdef _WIN32
+    return (u64)GetTickCount64();
+#else
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000 + (u64)ts.tv_nsec / 1000000;
+#endif
+}
+
+void SysSleepMs (u64 ms) {
+#ifdef _WIN32
+    Sleep ((DWORD)ms);
+#else
+    struct timespec ts = {.tv_sec = ms / 1000, .tv_nsec = (ms % 1000) * 1000000};
+    while (nanosleep (&ts, &ts) && errno == EINTR) {}
+#endif
+}
+
 Str* SysStrError (i32 eno, Str* err_str) {
     if (!err_str) {
         LOG_ERROR ("Invalid arguments");
@@ -1,7 +1,23 @@
 #include <Reai/Util/Json.h>
 #include <string.h>
 
-static StrIter JSkipObject (StrIter si) {
+#include "JsonNumber.h"
+#include "JsonScan.h"
+
+/// Deepest nesting JSkipContainer will walk through.
+#define JSON_SKIP_MAX_DEPTH 1024
+
+///
+/// Skip an object or an array by only looking at strings and brackets inside it. Brackets
+/// must match and strings must be terminated, but separators and scalar values in between
+/// are not validated, since nobody is going to read them.
+///
+/// si[in] : Iterator at (or whitespace before) '{' or '['.
+///
+/// SUCCESS : Iterator just past matching '}' or ']'.
+/// FAILURE : `si` as passed in.
+///
+static StrIter JSkipContainer (StrIter si) {
     if (!StrIterRemainingLength (&si)) {
         return si;
     }
@@ -9,155 +25,326 @@ static StrIter JSkipObject (StrIter si) {
     StrIter saved_si = si;
     si               = JSkipWhitespace (si);
 
-    // starting of an object
-    if (StrIterPeek (&si) != '{') {
-        LOG_ERROR ("Invalid object start. Expected '{'.");
+    const char* p   = si.data + si.pos;
+    const char* end = si.data + si.length;
+
+    if (p == end || (*p != '{' && *p != '[')) {
+        LOG_ERROR ("Invalid container start. Expected '{' or '['.");
         return saved_si;
     }
-    StrIterNext (&si);
-    si = JSkipWhitespace (si);
-
-    StrIter read_si;
-    bool    expect_comma = false;
 
-    // while not at the end of object.
-    while (StrIterPeek (&si) && StrIterPeek (&si) != '}') {
-        if (expect_comma) {
-            if (StrIterPeek (&si) != ',') {
-                LOG_ERROR (
-                    "Expected ',' between key/value pairs in object. Invalid "
-                    "JSON object."
-                );
-                return saved_si;
-            }
-            StrIterNext (&si); // skip comma
-            si = JSkipWhitespace (si);
-        }
+    const JScanKernels* scan = JScanKernelsGet();
 
-        Str key = StrInit();
+    // one bit per open container, set if it's an array
+    u64  arrays[JSON_SKIP_MAX_DEPTH / 64] = {0};
+    size depth                            = 0;
 
-        // key start
-        read_si = JReadString (si, &key);
-        if (read_si.pos == si.pos) {
-            LOG_ERROR ("Failed to read string key in object. Invalid JSON");
-            StrDeinit (&key);
+    while (true) {
+        p = scan->structural (p, end);
+        if (p == end || !*p) {
+            LOG_ERROR ("Unexpected end of input inside object or array. Invalid JSON.");
             return saved_si;
         }
-        si = read_si;
-        si = JSkipWhitespace (si);
 
-        if (StrIterPeek (&si) != ':') {
-            LOG_ERROR ("Expected ':' after key string. Failed to read JSON");
-            StrDeinit (&key);
-            return saved_si;
-        }
-        StrIterNext (&si);
-        si = JSkipWhitespace (si);
+        switch (*p) {
+            case '"' : {
+                p++;
+                while (true) {
+                    p = scan->string (p, end);
+                    if (p == end || !*p || (*p == '\\' && end - p < 2)) {
+                        LOG_ERROR ("Unexpected end of string.");
+                        return saved_si;
+                    }
 
-        // skip values within object
-        read_si = JSkipValue (si);
+                    if (*p == '"') {
+                        break;
+                    }
 
-        // if still no advancement in read position
-        if (read_si.pos == si.pos) {
-            LOG_ERROR ("Failed to parse value. Invalid JSON.");
-            StrDeinit (&key);
-            return saved_si;
-        }
+                    // step over escaped character, so an escaped quote can't end the string
+                    p += 2;
+                }
+                p++;
+                break;
+            }
 
-        LOG_INFO ("User skipped reading of '%s' field in JSON object.", key.data);
+            case '{' :
+            case '[' : {
+                if (depth == JSON_SKIP_MAX_DEPTH) {
+                    LOG_ERROR ("JSON nested deeper than %d levels.", JSON_SKIP_MAX_DEPTH);
+                    return saved_si;
+                }
 
-        StrDeinit (&key);
-        si = read_si;
-        si = JSkipWhitespace (si);
+                u64 bit = (u64)1 << (depth % 64);
+                if (*p == '[') {
+                    arrays[depth / 64] |= bit;
+                } else {
+                    arrays[depth / 64] &= ~bit;
+                }
 
-        // expect a comma after a successful key-value pair read
-        expect_comma = true;
+                depth++;
+                p++;
+                break;
+            }
+
+            default : {
+                // '}' or ']', depth is at least 1 here since we started at a bracket
+                depth--;
+
+                bool is_array = (arrays[depth / 64] >> (depth % 64)) & 1;
+                if (is_array != (*p == ']')) {
+                    LOG_ERROR ("Mismatched '%c' in JSON. Invalid JSON.", *p);
+                    return saved_si;
+                }
+
+                p++;
+                if (!depth) {
+                    si.pos = p - si.data;
+                    return si;
+                }
+                break;
+            }
+        }
     }
+}
 
-    if (StrIterPeek (&si) != '}') {
-        LOG_ERROR ("Expected end of object '}' but found '%c'", StrIterPeek (&si));
-        return saved_si;
+StrIter JSkipWhitespace (StrIter si) {
+    if (!StrIterRemainingLength (&si)) {
+        return si;
     }
 
-    StrIterNext (&si);
+    // most calls land right on a token, don't pay for a kernel call then
+    const char* p = si.data + si.pos;
+    if (!JIsSpace (*p)) {
+        return si;
+    }
+
+    si.pos = JScanKernelsGet()->space (p + 1, si.data + si.length) - si.data;
     return si;
 }
 
-static StrIter JSkipArray (StrIter si) {
+static i32 JHexDigit (char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+///
+/// Read 4 hex digits of a `\uXXXX` sequence.
+///
+/// SUCCESS : Code unit.
+/// FAILURE : -1 if any of them is not a hex digit.
+///
+static i32 JReadHex4 (const char* p) {
+    i32 value = 0;
+    for (i32 i = 0; i < 4; i++) {
+        i32 digit = JHexDigit (p[i]);
+        if (digit < 0) {
+            return -1;
+        }
+        value = (value << 4) | digit;
+    }
+    return value;
+}
+
+StrIter JReadStringView (StrIter si, JStrView* view) {
     if (!StrIterRemainingLength (&si)) {
         return si;
     }
 
+    if (!view) {
+        LOG_ERROR ("Invalid string view to read into.");
+        return si;
+    }
+
     StrIter saved_si = si;
     si               = JSkipWhitespace (si);
 
-    // starting of an object
-    if (StrIterPeek (&si) != '[') {
-        LOG_ERROR ("Invalid array start. Expected '['.");
+    if (!StrIterRemainingLength (&si) || StrIterPeek (&si) != '"') {
         return saved_si;
     }
-    StrIterNext (&si);
-    si = JSkipWhitespace (si);
 
-    StrIter read_si;
-    bool    expect_comma = false;
+    const JScanKernels* scan    = JScanKernelsGet();
+    const char*         begin   = si.data + si.pos + 1;
+    const char*         end     = si.data + si.length;
+    const char*         p       = begin;
+    bool                escaped = false;
 
-    // while not at the end of array.
-    while (StrIterPeek (&si) && StrIterPeek (&si) != ']') {
-        if (expect_comma) {
-            if (StrIterPeek (&si) != ',') {
-                LOG_ERROR ("Expected ',' between values in array. Invalid JSON array.");
-                return saved_si;
-            }
-            StrIterNext (&si); // skip comma
-            si = JSkipWhitespace (si);
+    while (true) {
+        p = scan->string (p, end);
+        if (p == end || !*p) {
+            LOG_ERROR ("Unexpected end of string.");
+            return saved_si;
         }
 
-        // skip values within array
-        read_si = JSkipValue (si);
+        // end of string
+        if (*p == '"') {
+            break;
+        }
 
-        // if no advancement in read position
-        if (read_si.pos == si.pos) {
-            LOG_ERROR ("Failed to parse value. Invalid JSON.");
+        // escape sequence, only validated here
+        escaped = true;
+        if (end - p < 2) {
+            LOG_ERROR ("Unexpected end of string.");
             return saved_si;
         }
 
-        si = read_si;
-        si = JSkipWhitespace (si);
+        switch (p[1]) {
+            case '\\' :
+            case '"' :
+            case '/' :
+            case 'b' :
+            case 'f' :
+            case 'n' :
+            case 'r' :
+            case 't' :
+                p += 2;
+                break;
 
-        // expect a comma after a successful value read in array
-        expect_comma = true;
-    }
+            case 'u' :
+                if (end - p < 6 || JReadHex4 (p + 2) < 0) {
+                    LOG_ERROR ("Invalid unicode escape sequence in JSON string.");
+                    return saved_si;
+                }
+                p += 6;
+                break;
 
-    // end of array
-    if (StrIterPeek (&si) != ']') {
-        LOG_ERROR ("Invalid end of array. Expected ']'.");
-        return saved_si;
+            default :
+                LOG_ERROR ("Invalid escape sequence in JSON string.");
+                return saved_si;
+        }
     }
 
-    StrIterNext (&si);
+    view->data    = begin;
+    view->length  = p - begin;
+    view->escaped = escaped;
+
+    si.pos = (p + 1) - si.data;
     return si;
 }
 
-StrIter JSkipWhitespace (StrIter si) {
-    if (!StrIterRemainingLength (&si)) {
-        return si;
+///
+/// Append a code point to `str`, encoded as UTF-8.
+///
+static void JPushUtf8 (Str* str, u32 cp) {
+    char buf[4];
+    size n = 0;
+
+    if (cp < 0x80) {
+        buf[n++] = (char)cp;
+    } else if (cp < 0x800) {
+        buf[n++] = (char)(0xc0 | (cp >> 6));
+        buf[n++] = (char)(0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+        buf[n++] = (char)(0xe0 | (cp >> 12));
+        buf[n++] = (char)(0x80 | ((cp >> 6) & 0x3f));
+        buf[n++] = (char)(0x80 | (cp & 0x3f));
+    } else {
+        buf[n++] = (char)(0xf0 | (cp >> 18));
+        buf[n++] = (char)(0x80 | ((cp >> 12) & 0x3f));
+        buf[n++] = (char)(0x80 | ((cp >> 6) & 0x3f));
+        buf[n++] = (char)(0x80 | (cp & 0x3f));
+    }
+
+    StrPushBackCstr (str, buf, n);
+}
+
+bool JStrViewUnescape (const JStrView* view, Str* str) {
+    if (!view || !str) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
     }
 
-    while (StrIterRemainingLength (&si) && StrIterPeek (&si)) {
-        switch (StrIterPeek (&si)) {
-            case ' ' :
-            case '\t' :
-            case '\r' :
-            case '\n' :
-                StrIterNext (&si);
+    if (!view->length) {
+        return true;
+    }
+
+    // an unescaped value is never longer than its escaped form
+    StrReserve (str, str->length + view->length);
+
+    const char* p   = view->data;
+    const char* end = view->data + view->length;
+    while (p < end) {
+        // copy everything up to next escape in one go
+        const char* run = p;
+        const char* bs  = memchr (p, '\\', end - p);
+        p               = bs ? bs : end;
+        if (p > run) {
+            StrPushBackCstr (str, run, p - run);
+        }
+        if (p == end) {
+            break;
+        }
+
+        // views are validated while being read, so every escape sequence is complete
+        char c = p[1];
+        p     += 2;
+        switch (c) {
+            case 'b' :
+                StrPushBack (str, '\b');
+                break;
+            case 'f' :
+                StrPushBack (str, '\f');
+                break;
+            case 'n' :
+                StrPushBack (str, '\n');
+                break;
+            case 'r' :
+                StrPushBack (str, '\r');
                 break;
+            case 't' :
+                StrPushBack (str, '\t');
+                break;
+
+            case 'u' : {
+                u32 cp  = (u32)JReadHex4 (p);
+                p      += 4;
+
+                // a high surrogate followed by a low one makes a single code point,
+                // any other surrogate can't be represented
+                if (cp >= 0xd800 && cp <= 0xdbff && end - p >= 6 && p[0] == '\\' &&
+                    p[1] == 'u') {
+                    i32 low = JReadHex4 (p + 2);
+                    if (low >= 0xdc00 && low <= 0xdfff) {
+                        cp  = 0x10000 + ((cp - 0xd800) << 10) + ((u32)low - 0xdc00);
+                        p  += 6;
+                    }
+                }
+                JPushUtf8 (str, cp >= 0xd800 && cp <= 0xdfff ? 0xfffd : cp);
+                break;
+            }
+
+            // backslash, quote and slash stand for themselves
             default :
-                return si;
+                StrPushBack (str, c);
+                break;
         }
     }
 
-    return si;
+    return true;
+}
+
+bool JStrViewEqZstr (const JStrView* view, const char* zstr) {
+    if (!view || !zstr) {
+        return false;
+    }
+
+    if (!view->escaped) {
+        return strlen (zstr) == view->length && !memcmp (view->data, zstr, view->length);
+    }
+
+    Str  value = StrInit();
+    bool equal = false;
+    JStrViewUnescape (view, &value);
+    equal = strlen (zstr) == value.length && !memcmp (value.data, zstr, value.length);
+    StrDeinit (&value);
+    return equal;
 }
 
 StrIter JReadString (StrIter si, Str* str) {
@@ -170,103 +357,14 @@ StrIter JReadString (StrIter si, Str* str) {
         return si;
     }
 
-    StrIter saved_si = si;
-    si               = JSkipWhitespace (si);
-
-    // string start
-    if (StrIterRemainingLength (&si) && StrIterPeek (&si) == '"') {
-        StrIterNext (&si);
-
-        // while a printable character
-        while (StrIterRemainingLength (&si) && StrIterPeek (&si)) {
-            // three cases
-            // - end of string (return)
-            // - an escape sequence (processed and appended)
-            // - acceptable string character (appended)
-            switch (StrIterPeek (&si)) {
-                // end of string
-                case '"' :
-                    StrIterNext (&si);
-                    return si;
-
-                // starting of an escape sequence
-                case '\\' :
-                    StrIterNext (&si);
-                    if (!StrIterRemainingLength (&si)) {
-                        LOG_ERROR ("Unexpected end of string.");
-                        StrClear (str);
-                        return saved_si;
-                    }
-
-                    switch (StrIterPeek (&si)) {
-                        // escape sequence
-                        case '\\' :
-                            StrPushBack (str, '\\');
-                            StrIterNext (&si);
-                            break;
-
-                        case '"' :
-                            StrPushBack (str, '"');
-                            StrIterNext (&si);
-                            break;
-
-                        case '/' :
-                            StrPushBack (str, '/');
-                            StrIterNext (&si);
-                            break;
-
-                        case 'b' :
-                            StrPushBack (str, '\b');
-                            StrIterNext (&si);
-                            break;
-
-                        case 'f' :
-                            StrPushBack (str, '\f');
-                            StrIterNext (&si);
-                            break;
-
-                        case 'n' :
-                            StrPushBack (str, '\n');
-                            StrIterNext (&si);
-                            break;
-
-                        case 'r' :
-                            StrPushBack (str, '\r');
-                            StrIterNext (&si);
-                            break;
-
-                        case 't' :
-                            StrPushBack (str, '\t');
-                            StrIterNext (&si);
-                            break;
-
-                        // espaced unicode sequence
-                        case 'u' :
-                            LOG_ERROR (
-                                "No unicode support '%.*s'. Unicode sequence will be skipped.",
-                                (i32)MIN2 (StrIterRemainingLength (&si), 6),
-                                si.data + si.pos - 1
-                            );
-                            StrIterMove (&si, 5);
-                            break;
-
-                        default :
-                            LOG_ERROR ("Invalid JSON object key string.");
-                            StrClear (str);
-                            return saved_si;
-                    }
-                    break;
-
-                // default allowed characters
-                default :
-                    StrPushBack (str, StrIterPeek (&si));
-                    StrIterNext (&si);
-                    break;
-            }
-        }
+    JStrView view    = JStrViewInit();
+    StrIter  read_si = JReadStringView (si, &view);
+    if (read_si.pos == si.pos) {
+        return si;
     }
 
-    return si;
+    JStrViewUnescape (&view, str);
+    return read_si;
 }
 
 StrIter JReadNumber (StrIter si, Number* num) {
@@ -281,124 +379,46 @@ StrIter JReadNumber (StrIter si, Number* num) {
 
     StrIter saved_si = si;
     si               = JSkipWhitespace (si);
-    Str ns           = StrInit();
-
-    bool is_neg = false;
-    if (StrIterPeek (&si) == '-') {
-        is_neg = true;
-        StrIterNext (&si);
-    }
-
-    bool is_flt             = false;
-    bool has_exp            = false;
-    bool has_exp_plus_minus = false;
-    bool is_parsing         = true;
-
-    while (is_parsing && StrIterRemainingLength (&si) && StrIterPeek (&si)) {
-        switch (StrIterPeek (&si)) {
-            case 'E' :
-            case 'e' :
-                if (has_exp) {
-                    LOG_ERROR ("Invalid number. Multiple exponent indicators.");
-                    StrDeinit (&ns);
-                    return saved_si;
-                }
-                has_exp = true;
-                is_flt  = true;
-                StrPushBack (&ns, StrIterPeek (&si));
-                StrIterNext (&si);
-                break;
 
-            case '.' :
-                if (is_flt) {
-                    LOG_ERROR ("Invalid number. Multiple decimal indicators.");
-                    StrDeinit (&ns);
-                    return saved_si;
-                }
-                is_flt = true;
-                StrPushBack (&ns, StrIterPeek (&si));
-                StrIterNext (&si);
-                break;
+    const char* stop = JNumberParse (si.data + si.pos, si.data + si.length, num);
+    if (!stop) {
+        return saved_si;
+    }
 
-            case '0' :
-            case '1' :
-            case '2' :
-            case '3' :
-            case '4' :
-            case '5' :
-            case '6' :
-            case '7' :
-            case '8' :
-            case '9' :
-                StrPushBack (&ns, StrIterPeek (&si));
-                StrIterNext (&si);
-                break;
+    si.pos = stop - si.data;
+    return si;
+}
 
-            case '-' :
-            case '+' :
-                // +/- can only appear after an exponent
-                if (!has_exp) {
-                    LOG_ERROR (
-                        "Invalid number. Exponent sign indicators '+' or '-' "
-                        "must appear after exponent 'E' or 'e' indicator."
-                    );
-                    StrDeinit (&ns);
-                    return saved_si;
-                }
-                if (has_exp_plus_minus) {
-                    LOG_ERROR (
-                        "Invalid number. Multiple '+' or '-' in Number. "
-                        "Expected only once after 'e' or 'E'."
-                    );
-                    StrDeinit (&ns);
-                    return saved_si;
-                }
-                has_exp_plus_minus = true;
-                StrPushBack (&ns, StrIterPeek (&si));
-                StrIterNext (&si);
-                break;
+///
+/// Read a number, or a string holding nothing but a number, since some numbers are sent
+/// quoted by the API.
+///
+/// SUCCESS : `StrIter` advanced past number or string.
+/// FAILURE : `si` as passed in.
+///
+static StrIter JReadNumberOrString (StrIter si, Number* num) {
+    StrIter saved_si = si;
+    si               = JSkipWhitespace (si);
 
-            default :
-                is_parsing = false;
-                break;
-        }
+    if (StrIterPeek (&si) != '"') {
+        StrIter read_si = JReadNumber (si, num);
+        return read_si.pos == si.pos ? saved_si : read_si;
     }
 
-    if (!ns.length) {
-        LOG_ERROR (
-            "Failed to parse number. '%.*s'",
-            (i32)MIN2 (StrIterRemainingLength (&saved_si), 8),
-            saved_si.data + saved_si.pos
-        );
-        StrDeinit (&ns);
+    JStrView view    = JStrViewInit();
+    StrIter  read_si = JReadStringView (si, &view);
+    if (read_si.pos == si.pos) {
         return saved_si;
     }
 
-    // convert to number
-    char* end = NULL;
-    if (is_flt) {
-        num->f = strtod (ns.data, &end);
-    } else {
-        num->i = strtoll (ns.data, &end, 10);
-    }
-    if (end == ns.data) {
-        LOG_ERROR ("Failed to convert string to number.");
-        StrDeinit (&ns);
+    const char* end  = view.data + view.length;
+    const char* stop = view.escaped ? NULL : JNumberParse (view.data, end, num);
+    if (stop != end) {
+        LOG_ERROR ("Expected a number in string '%.*s'.", (i32)view.length, view.data);
         return saved_si;
     }
 
-    // negate
-    if (is_neg) {
-        if (is_flt) {
-            num->f *= -1;
-        } else {
-            num->i *= -1;
-        }
-    }
-    num->is_float = is_flt;
-
-    StrDeinit (&ns);
-    return si;
+    return read_si;
 }
 
 StrIter JReadInteger (StrIter si, i64* val) {
@@ -413,7 +433,7 @@ StrIter JReadInteger (StrIter si, i64* val) {
 
     StrIter saved_si = si;
     Number  num;
-    si = JReadNumber (si, &num);
+    si = JReadNumberOrString (si, &num);
 
     if (si.pos == saved_si.pos) {
         LOG_ERROR ("Failed to parse integer number.");
@@ -442,7 +462,7 @@ StrIter JReadFloat (StrIter si, f64* val) {
 
     StrIter saved_si = si;
     Number  num;
-    si = JReadNumber (si, &num);
+    si = JReadNumberOrString (si, &num);
 
     if (si.pos == saved_si.pos) {
         LOG_ERROR ("Failed to parse floating point number");
@@ -540,6 +560,10 @@ StrIter JReadNull (StrIter si, bool* is_null) {
     }
 }
 
+const char* JScanKernelName() {
+    return JScanKernelsGet()->name;
+}
+
 StrIter JSkipValue (StrIter si) {
     if (!StrIterRemainingLength (&si)) {
         return si;
@@ -585,10 +609,9 @@ StrIter JSkipValue (StrIter si) {
 
     // expecting a string
     if (StrIterPeek (&si) == '"') {
-        StrIter before_si = si;
-        Str     s         = StrInit();
-        si                = JReadString (si, &s);
-        StrDeinit (&s);
+        StrIter  before_si = si;
+        JStrView s         = JStrViewInit();
+        si                 = JReadStringView (si, &s);
 
         if (si.pos == before_si.pos) {
             LOG_ERROR ("Failed to read string value. Expected string. Invalid JSON.");
@@ -615,7 +638,7 @@ StrIter JSkipValue (StrIter si) {
     // looks like starting of an object
     if (StrIterPeek (&si) == '{') {
         StrIter before_si = si;
-        si                = JSkipObject (si);
+        si                = JSkipContainer (si);
 
         if (si.pos == before_si.pos) {
             LOG_ERROR ("Failed to read object. Expected an object. Invalid JSON.");
@@ -628,7 +651,7 @@ StrIter JSkipValue (StrIter si) {
     // looks like starting of an array
     if (StrIterPeek (&si) == '[') {
         StrIter before_si = si;
-        si                = JSkipArray (si);
+        si                = JSkipContainer (si);
 
         if (si.pos == before_si.pos) {
             LOG_ERROR ("Failed to read array. Expected an array. Invalid JSON.");
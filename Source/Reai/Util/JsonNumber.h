@@ -0,0 +1,37 @@
+/**
+ * @file JsonNumber.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Parsing of JSON numbers right where they are in the input, without copying them out.
+ *    Private to JSON reader, not installed.
+ * */
+
+#ifndef REAI_UTIL_JSON_NUMBER_H
+#define REAI_UTIL_JSON_NUMBER_H
+
+#include <Reai/Util/Json.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Parse a JSON number starting at `p`. Integers too large for `i64` are clamped, and
+    /// floats are correctly rounded to nearest.
+    ///
+    /// p[in]    : First character of number, whitespace already skipped.
+    /// end[in]  : End of input.
+    /// num[out] : Parsed number.
+    ///
+    /// SUCCESS : Pointer just past number.
+    /// FAILURE : NULL if there's no valid number at `p`.
+    ///
+    const char* JNumberParse (const char* p, const char* end, Number* num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REAI_UTIL_JSON_NUMBER_H
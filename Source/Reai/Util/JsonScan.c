@@ -0,0 +1,294 @@
+/**
+ * @file JsonScan.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include "JsonScan.h"
+
+#include <Reai/Sys.h>
+
+#if !defined(REAI_JSON_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#    define JSON_SCAN_SSE2 1
+#    include <emmintrin.h>
+
+// AVX2 kernels are built with a target attribute, and only used if CPU has it
+#    if defined(__GNUC__) || defined(__clang__)
+#        define JSON_SCAN_AVX2 1
+#        include <immintrin.h>
+#        define JSON_SCAN_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#    endif
+#endif
+
+#ifdef _MSC_VER
+#    include <intrin.h>
+#endif
+
+/// Kernels picked so far, NULL until first use.
+static const JScanKernels* json_scan_kernels = NULL;
+
+/* scalar */
+
+static const char* JScanStringScalar (const char* p, const char* end) {
+    while (p < end && *p != '"' && *p != '\\' && *p) {
+        p++;
+    }
+    return p;
+}
+
+static const char* JScanSpaceScalar (const char* p, const char* end) {
+    while (p < end && JIsSpace (*p)) {
+        p++;
+    }
+    return p;
+}
+
+static const char* JScanStructuralScalar (const char* p, const char* end) {
+    for (; p < end; p++) {
+        switch (*p) {
+            case '"' :
+            case '{' :
+            case '}' :
+            case '[' :
+            case ']' :
+            case '\0' :
+                return p;
+            default :
+                break;
+        }
+    }
+    return p;
+}
+
+static const JScanKernels scalar_kernels = {
+    .name       = "scalar",
+    .string     = JScanStringScalar,
+    .space      = JScanSpaceScalar,
+    .structural = JScanStructuralScalar,
+};
+
+#ifdef JSON_SCAN_SSE2
+
+///
+/// Index of lowest set bit. `mask` must not be 0.
+///
+static inline u32 JLowestBit (u32 mask) {
+#    ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward (&idx, mask);
+    return (u32)idx;
+#    else
+    return (u32)__builtin_ctz (mask);
+#    endif
+}
+
+/* sse2 */
+
+///
+/// Masks below have bit `i` set if `p[i]` is a character the kernel stops at.
+///
+
+static inline u32 JStringMask16 (const char* p) {
+    __m128i block = _mm_loadu_si128 ((const __m128i*)p);
+    __m128i found = _mm_or_si128 (
+        _mm_or_si128 (
+            _mm_cmpeq_epi8 (block, _mm_set1_epi8 ('"')),
+            _mm_cmpeq_epi8 (block, _mm_set1_epi8 ('\\'))
+        ),
+        _mm_cmpeq_epi8 (block, _mm_setzero_si128())
+    );
+    return (u32)_mm_movemask_epi8 (found);
+}
+
+static inline u32 JSpaceMask16 (const char* p) {
+    __m128i block = _mm_loadu_si128 ((const __m128i*)p);
+    __m128i found = _mm_or_si128 (
+        _mm_or_si128 (
+            _mm_cmpeq_epi8 (block, _mm_set1_epi8 (' ')),
+            _mm_cmpeq_epi8 (block, _mm_set1_epi8 ('\t'))
+        ),
+        _mm_or_si128 (
+            _mm_cmpeq_epi8 (block, _mm_set1_epi8 ('\r')),
+            _mm_cmpeq_epi8 (block, _mm_set1_epi8 ('\n'))
+        )
+    );
+    return ~(u32)_mm_movemask_epi8 (found) & 0xffff;
+}
+
+// '[' | 0x20 == '{' and ']' | 0x20 == '}', so folding case finds both brackets in one compare
+static inline u32 JStructuralMask16 (const char* p) {
+    __m128i block  = _mm_loadu_si128 ((const __m128i*)p);
+    __m128i folded = _mm_or_si128 (block, _mm_set1_epi8 (0x20));
+    __m128i found  = _mm_or_si128 (
+        _mm_or_si128 (
+            _mm_cmpeq_epi8 (block, _mm_set1_epi8 ('"')),
+            _mm_cmpeq_epi8 (block, _mm_setzero_si128())
+        ),
+        _mm_or_si128 (
+            _mm_cmpeq_epi8 (folded, _mm_set1_epi8 ('{')),
+            _mm_cmpeq_epi8 (folded, _mm_set1_epi8 ('}'))
+        )
+    );
+    return (u32)_mm_movemask_epi8 (found);
+}
+
+static const char* JScanStringSse2 (const char* p, const char* end) {
+    for (; end - p >= 16; p += 16) {
+        u32 mask = JStringMask16 (p);
+        if (mask) {
+            return p + JLowestBit (mask);
+        }
+    }
+    return JScanStringScalar (p, end);
+}
+
+static const char* JScanSpaceSse2 (const char* p, const char* end) {
+    for (; end - p >= 16; p += 16) {
+        u32 mask = JSpaceMask16 (p);
+        if (mask) {
+            return p + JLowestBit (mask);
+        }
+    }
+    return JScanSpaceScalar (p, end);
+}
+
+static const char* JScanStructuralSse2 (const char* p, const char* end) {
+    for (; end - p >= 16; p += 16) {
+        u32 mask = JStructuralMask16 (p);
+        if (mask) {
+            return p + JLowestBit (mask);
+        }
+    }
+    return JScanStructuralScalar (p, end);
+}
+
+static const JScanKernels sse2_kernels = {
+    .name       = "sse2",
+    .string     = JScanStringSse2,
+    .space      = JScanSpaceSse2,
+    .structural = JScanStructuralSse2,
+};
+
+#endif // JSON_SCAN_SSE2
+
+#ifdef JSON_SCAN_AVX2
+
+/* avx2 */
+
+JSON_SCAN_TARGET_AVX2 static inline u32 JStringMask32 (const char* p) {
+    __m256i block = _mm256_loadu_si256 ((const __m256i*)p);
+    __m256i found = _mm256_or_si256 (
+        _mm256_or_si256 (
+            _mm256_cmpeq_epi8 (block, _mm256_set1_epi8 ('"')),
+            _mm256_cmpeq_epi8 (block, _mm256_set1_epi8 ('\\'))
+        ),
+        _mm256_cmpeq_epi8 (block, _mm256_setzero_si256())
+    );
+    return (u32)_mm256_movemask_epi8 (found);
+}
+
+JSON_SCAN_TARGET_AVX2 static inline u32 JSpaceMask32 (const char* p) {
+    __m256i block = _mm256_loadu_si256 ((const __m256i*)p);
+    __m256i found = _mm256_or_si256 (
+        _mm256_or_si256 (
+            _mm256_cmpeq_epi8 (block, _mm256_set1_epi8 (' ')),
+            _mm256_cmpeq_epi8 (block, _mm256_set1_epi8 ('\t'))
+        ),
+        _mm256_or_si256 (
+            _mm256_cmpeq_epi8 (block, _mm256_set1_epi8 ('\r')),
+            _mm256_cmpeq_epi8 (block, _mm256_set1_epi8 ('\n'))
+        )
+    );
+    return ~(u32)_mm256_movemask_epi8 (found);
+}
+
+JSON_SCAN_TARGET_AVX2 static inline u32 JStructuralMask32 (const char* p) {
+    __m256i block  = _mm256_loadu_si256 ((const __m256i*)p);
+    __m256i folded = _mm256_or_si256 (block, _mm256_set1_epi8 (0x20));
+    __m256i found  = _mm256_or_si256 (
+        _mm256_or_si256 (
+            _mm256_cmpeq_epi8 (block, _mm256_set1_epi8 ('"')),
+            _mm256_cmpeq_epi8 (block, _mm256_setzero_si256())
+        ),
+        _mm256_or_si256 (
+            _mm256_cmpeq_epi8 (folded, _mm256_set1_epi8 ('{')),
+            _mm256_cmpeq_epi8 (folded, _mm256_set1_epi8 ('}'))
+        )
+    );
+    return (u32)_mm256_movemask_epi8 (found);
+}
+
+///
+/// In API responses the next character of interest is mostly a few bytes away, where
+/// setting up 32 byte registers costs more than it saves. So AVX2 kernels look at first
+/// 16 bytes the SSE2 way, and only go 32 bytes at a time over longer runs.
+///
+#    define JSON_SCAN_AVX2_KERNEL(name, mask16, mask32, tail)                                      \
+        JSON_SCAN_TARGET_AVX2 static const char* name (const char* p, const char* end) {           \
+            if (end - p >= 16) {                                                                   \
+                u32 mask = mask16 (p);                                                             \
+                if (mask) {                                                                        \
+                    return p + JLowestBit (mask);                                                  \
+                }                                                                                  \
+                p += 16;                                                                           \
+            }                                                                                      \
+            for (; end - p >= 32; p += 32) {                                                       \
+                u32 mask = mask32 (p);                                                             \
+                if (mask) {                                                                        \
+                    return p + JLowestBit (mask);                                                  \
+                }                                                                                  \
+            }                                                                                      \
+            return tail (p, end);                                                                  \
+        }
+
+JSON_SCAN_AVX2_KERNEL (JScanStringAvx2, JStringMask16, JStringMask32, JScanStringScalar)
+JSON_SCAN_AVX2_KERNEL (JScanSpaceAvx2, JSpaceMask16, JSpaceMask32, JScanSpaceScalar)
+JSON_SCAN_AVX2_KERNEL (
+    JScanStructuralAvx2,
+    JStructuralMask16,
+    JStructuralMask32,
+    JScanStructuralScalar
+)
+
+static const JScanKernels avx2_kernels = {
+    .name       = "avx2",
+    .string     = JScanStringAvx2,
+    .space      = JScanSpaceAvx2,
+    .structural = JScanStructuralAvx2,
+};
+
+#endif // JSON_SCAN_AVX2
+
+size JScanKernelsSupported (const JScanKernels** kernels) {
+    size count       = 0;
+    kernels[count++] = &scalar_kernels;
+
+#ifdef JSON_SCAN_SSE2
+    // every x86-64 CPU has SSE2
+    kernels[count++] = &sse2_kernels;
+#endif
+
+#ifdef JSON_SCAN_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports ("avx2")) {
+        kernels[count++] = &avx2_kernels;
+    }
+#endif
+
+    return count;
+}
+
+const JScanKernels* JScanKernelsGet() {
+    const JScanKernels* kernels = json_scan_kernels;
+    if (kernels) {
+        return kernels;
+    }
+
+    const JScanKernels* supported[JSON_SCAN_MAX_KERNELS];
+    kernels = supported[JScanKernelsSupported (supported) - 1];
+
+    // threads racing here pick the same kernels
+    SysAtomicCasPtr ((void* volatile*)&json_scan_kernels, NULL, (void*)kernels);
+    return kernels;
+}
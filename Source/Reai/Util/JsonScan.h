@@ -0,0 +1,68 @@
+/**
+ * @file JsonScan.h
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ *
+ * @b Kernels that find next character of interest in JSON input, a block of 16 (SSE2)
+ *    or 32 (AVX2) bytes at a time. Best kernels for the CPU are picked once at runtime,
+ *    with a scalar fallback everywhere else.
+ *    Private to JSON reader, not installed.
+ * */
+
+#ifndef REAI_UTIL_JSON_SCAN_H
+#define REAI_UTIL_JSON_SCAN_H
+
+#include <Reai/Types.h>
+
+///
+/// Find first character in `[p, end)` a kernel looks for.
+///
+/// SUCCESS : Pointer to character found.
+/// FAILURE : `end` if there's none.
+///
+typedef const char* (*JScanFn) (const char* p, const char* end);
+
+typedef struct JScanKernels {
+    const char* name;       /**< @b "avx2", "sse2" or "scalar". */
+    JScanFn     string;     /**< @b Finds '"', '\\' or NUL. */
+    JScanFn     space;      /**< @b Finds first character that isn't JSON whitespace. */
+    JScanFn     structural; /**< @b Finds '"', '{', '}', '[', ']' or NUL. */
+} JScanKernels;
+
+/// Most kernel sets a CPU can support, see `JScanKernelsSupported`.
+#define JSON_SCAN_MAX_KERNELS 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    ///
+    /// Get kernels to scan with, picking best ones supported by this CPU on first use.
+    /// Safe to call from many threads at once.
+    ///
+    /// SUCCESS : Kernels to use from now on.
+    /// FAILURE : Does not fail, scalar kernels are always there.
+    ///
+    const JScanKernels* JScanKernelsGet();
+
+    ///
+    /// Get every set of kernels this CPU can run, so they can be checked against each other.
+    ///
+    /// kernels[out] : Filled with up to `JSON_SCAN_MAX_KERNELS` sets, scalar first and the
+    ///                one `JScanKernelsGet` picks last.
+    ///
+    /// SUCCESS : Number of sets filled in, at least 1.
+    /// FAILURE : Does not fail.
+    ///
+    size JScanKernelsSupported (const JScanKernels** kernels);
+
+#ifdef __cplusplus
+}
+#endif
+
+static inline bool JIsSpace (char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+#endif // REAI_UTIL_JSON_SCAN_H
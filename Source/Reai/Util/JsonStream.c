@@ -0,0 +1,191 @@
+/**
+ * @file JsonStream.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include <Reai/Log.h>
+#include <Reai/Util/JsonStream.h>
+
+#include <ctype.h>
+#include <string.h>
+
+static void Append (Str* dst, const char* data, size length) {
+    if (length) {
+        StrPushBackCstr (dst, data, length);
+    }
+}
+
+///
+/// Hand accumulated element over to reader, unless it's only whitespace (e.g. in `[ ]`).
+///
+static bool FlushElement (JsonStream* js) {
+    bool blank = true;
+    for (size i = 0; i < js->element.length; i++) {
+        if (!isspace ((unsigned char)js->element.data[i])) {
+            blank = false;
+            break;
+        }
+    }
+
+    if (!blank) {
+        js->elements++;
+        StrIter si = StrIterInitFromStr (&js->element);
+        if (!js->reader (si, js->ctx)) {
+            LOG_ERROR ("Reader failed to read element %llu of streamed array.", js->elements);
+            js->failed = true;
+        }
+    }
+
+    StrClear (&js->element);
+    return !js->failed;
+}
+
+///
+/// Check whether array that just opened at the end of envelope belongs to the key to stream.
+/// Envelope is expected to end with `"<key>" : [` at this point.
+///
+static bool ArrayKeyMatches (JsonStream* js) {
+    const char* env = js->envelope.data;
+    size        len = js->envelope.length - 1; // skip '['
+
+    if (!js->array_key || js->key_end < js->key_start || js->key_end >= len) {
+        return false;
+    }
+
+    bool colon = false;
+    for (size i = js->key_end + 1; i < len; i++) {
+        if (env[i] == ':' && !colon) {
+            colon = true;
+        } else if (!isspace ((unsigned char)env[i])) {
+            return false;
+        }
+    }
+
+    size key_len = js->key_end - js->key_start;
+    return colon && strlen (js->array_key) == key_len &&
+           !memcmp (env + js->key_start, js->array_key, key_len);
+}
+
+void JsonStreamDeinit (JsonStream* js) {
+    if (!js) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    StrDeinit (&js->envelope);
+    StrDeinit (&js->element);
+    memset (js, 0, sizeof (JsonStream));
+}
+
+bool JsonStreamFeed (JsonStream* js, const char* data, size length) {
+    if (!js || !js->reader || (!data && length)) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    if (js->failed) {
+        return false;
+    }
+
+    // bytes in [run, i) are yet to be copied to current destination
+    size run = 0;
+    for (size i = 0; i < length; i++) {
+        char c = data[i];
+
+        if (js->in_string) {
+            if (js->escaped) {
+                js->escaped = false;
+            } else if (c == '\\') {
+                js->escaped = true;
+            } else if (c == '"') {
+                js->in_string = false;
+                if (!js->streaming && js->depth == 1) {
+                    js->key_end = js->envelope.length + (i - run);
+                }
+            }
+            continue;
+        }
+
+        switch (c) {
+            case '"' :
+                js->in_string = true;
+                if (!js->streaming && js->depth == 1) {
+                    js->key_start = js->envelope.length + (i - run) + 1;
+                }
+                break;
+
+            case '{' :
+                js->depth++;
+                break;
+
+            case '[' :
+                if (!js->streaming && !js->streamed && js->depth == 1) {
+                    Append (&js->envelope, data + run, i + 1 - run);
+                    run           = i + 1;
+                    js->streaming = ArrayKeyMatches (js);
+                }
+                js->depth++;
+                break;
+
+            case ',' :
+                if (js->streaming && js->depth == 2) {
+                    Append (&js->element, data + run, i - run);
+                    run = i + 1;
+                    if (!FlushElement (js)) {
+                        return false;
+                    }
+                }
+                break;
+
+            case '}' :
+            case ']' :
+                if (!js->depth) {
+                    LOG_ERROR ("Unbalanced '%c' in JSON stream.", c);
+                    js->failed = true;
+                    return false;
+                }
+
+                if (c == ']' && js->streaming && js->depth == 2) {
+                    // closing bracket stays in envelope
+                    Append (&js->element, data + run, i - run);
+                    run = i;
+                    if (!FlushElement (js)) {
+                        return false;
+                    }
+                    js->streaming = false;
+                    js->streamed  = true;
+                }
+                js->depth--;
+                break;
+
+            default :
+                break;
+        }
+    }
+
+    Append (js->streaming ? &js->element : &js->envelope, data + run, length - run);
+    return true;
+}
+
+bool JsonStreamFinish (JsonStream* js, Str* envelope) {
+    if (!js || !envelope) {
+        LOG_ERROR ("Invalid arguments.");
+        return false;
+    }
+
+    if (js->failed) {
+        return false;
+    }
+
+    if (js->depth || js->in_string || js->streaming) {
+        LOG_ERROR ("JSON stream ended in the middle of a value.");
+        js->failed = true;
+        return false;
+    }
+
+    StrMerge (envelope, &js->envelope);
+    StrClear (&js->envelope);
+    return true;
+}
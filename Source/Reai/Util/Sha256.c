@@ -0,0 +1,255 @@
+/**
+ * @file Sha256.c
+ * @date 16th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright (c) RevEngAI. All Rights Reserved.
+ * */
+
+#include <Reai/Log.h>
+#include <Reai/Sys.h>
+#include <Reai/Util/Sha256.h>
+
+// libc
+#include <errno.h>
+#include <string.h>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+/// Bytes of file mapped at once. Multiple of allocation granularity on all platforms.
+#define SHA256_MAP_WINDOW (64 * 1024 * 1024)
+
+static const u32 K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void Compress (u32 state[8], const u8* block) {
+    u32 w[64];
+    for (size i = 0; i < 16; i++) {
+        w[i] = ((u32)block[i * 4] << 24) | ((u32)block[i * 4 + 1] << 16) |
+               ((u32)block[i * 4 + 2] << 8) | (u32)block[i * 4 + 3];
+    }
+    for (size i = 16; i < 64; i++) {
+        u32 s0 = ROTR (w[i - 15], 7) ^ ROTR (w[i - 15], 18) ^ (w[i - 15] >> 3);
+        u32 s1 = ROTR (w[i - 2], 17) ^ ROTR (w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i]   = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    u32 a = state[0], b = state[1], c = state[2], d = state[3];
+    u32 e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (size i = 0; i < 64; i++) {
+        u32 t1 = h + (ROTR (e, 6) ^ ROTR (e, 11) ^ ROTR (e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+        u32 t2 = (ROTR (a, 2) ^ ROTR (a, 13) ^ ROTR (a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h      = g;
+        g      = f;
+        f      = e;
+        e      = d + t1;
+        d      = c;
+        c      = b;
+        b      = a;
+        a      = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+void Sha256Update (Sha256* ctx, const void* data, size length) {
+    if (!ctx || (!data && length)) {
+        LOG_ERROR ("Invalid arguments.");
+        return;
+    }
+
+    const u8* p  = data;
+    ctx->length += length;
+
+    if (ctx->block_fill) {
+        size take = 64 - ctx->block_fill;
+        take      = take > length ? length : take;
+        memcpy (ctx->block + ctx->block_fill, p, take);
+        ctx->block_fill += take;
+        p               += take;
+        length          -= take;
+
+        if (ctx->block_fill < 64) {
+            return;
+        }
+        Compress (ctx->state, ctx->block);
+        ctx->block_fill = 0;
+    }
+
+    // full blocks are hashed straight from input, without copying
+    for (; length >= 64; p += 64, length -= 64) {
+        Compress (ctx->state, p);
+    }
+
+    if (length) {
+        memcpy (ctx->block, p, length);
+        ctx->block_fill = length;
+    }
+}
+
+Str* Sha256Final (Sha256* ctx, Str* hex) {
+    if (!ctx || !hex) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    u64 bits = ctx->length * 8;
+
+    ctx->block[ctx->block_fill++] = 0x80;
+    if (ctx->block_fill > 56) {
+        memset (ctx->block + ctx->block_fill, 0, 64 - ctx->block_fill);
+        Compress (ctx->state, ctx->block);
+        ctx->block_fill = 0;
+    }
+    memset (ctx->block + ctx->block_fill, 0, 56 - ctx->block_fill);
+    for (size i = 0; i < 8; i++) {
+        ctx->block[56 + i] = (u8)(bits >> (56 - i * 8));
+    }
+    Compress (ctx->state, ctx->block);
+
+    static const char digits[] = "0123456789abcdef";
+    char              out[SHA256_HEX_DIGEST_SIZE];
+    for (size i = 0; i < SHA256_DIGEST_SIZE; i++) {
+        u8 byte        = (u8)(ctx->state[i / 4] >> (24 - (i % 4) * 8));
+        out[i * 2]     = digits[byte >> 4];
+        out[i * 2 + 1] = digits[byte & 0xf];
+    }
+    StrPushBackCstr (hex, out, SHA256_HEX_DIGEST_SIZE);
+
+    memset (ctx, 0, sizeof (Sha256));
+    return hex;
+}
+
+Str* Sha256File (const char* path, Str* hex) {
+    if (!path || !hex) {
+        LOG_ERROR ("Invalid arguments.");
+        return NULL;
+    }
+
+    Sha256 ctx = Sha256Init();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA (
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN,
+        NULL
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR ("Failed to open '%s' for hashing.", path);
+        return NULL;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx (file, &file_size)) {
+        LOG_ERROR ("Failed to get size of '%s'.", path);
+        CloseHandle (file);
+        return NULL;
+    }
+
+    u64    total   = (u64)file_size.QuadPart;
+    HANDLE mapping = NULL;
+    if (total) {
+        mapping = CreateFileMappingA (file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!mapping) {
+            LOG_ERROR ("Failed to map '%s'.", path);
+            CloseHandle (file);
+            return NULL;
+        }
+    }
+
+    for (u64 offset = 0; offset < total; offset += SHA256_MAP_WINDOW) {
+        size  window = total - offset > SHA256_MAP_WINDOW ? SHA256_MAP_WINDOW : total - offset;
+        void* view   = MapViewOfFile (
+            mapping,
+            FILE_MAP_READ,
+            (DWORD)(offset >> 32),
+            (DWORD)(offset & 0xffffffff),
+            window
+        );
+        if (!view) {
+            LOG_ERROR ("Failed to map '%s' at offset %llu.", path, offset);
+            CloseHandle (mapping);
+            CloseHandle (file);
+            return NULL;
+        }
+
+        Sha256Update (&ctx, view, window);
+        UnmapViewOfFile (view);
+    }
+
+    if (mapping) {
+        CloseHandle (mapping);
+    }
+    CloseHandle (file);
+#else
+    int fd = open (path, O_RDONLY);
+    if (fd < 0) {
+        Str syserr;
+        StrInitStack (&syserr, SYS_ERROR_STR_MAX_LENGTH, {
+            LOG_ERROR ("open() failed : %s.", SysStrError (errno, &syserr)->data);
+        });
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat (fd, &st) < 0) {
+        Str syserr;
+        StrInitStack (&syserr, SYS_ERROR_STR_MAX_LENGTH, {
+            LOG_ERROR ("fstat() failed : %s.", SysStrError (errno, &syserr)->data);
+        });
+        close (fd);
+        return NULL;
+    }
+
+    u64 total = (u64)st.st_size;
+    for (u64 offset = 0; offset < total; offset += SHA256_MAP_WINDOW) {
+        size  window = total - offset > SHA256_MAP_WINDOW ? SHA256_MAP_WINDOW : total - offset;
+        void* view   = mmap (NULL, window, PROT_READ, MAP_PRIVATE, fd, (off_t)offset);
+        if (view == MAP_FAILED) {
+            Str syserr;
+            StrInitStack (&syserr, SYS_ERROR_STR_MAX_LENGTH, {
+                LOG_ERROR ("mmap() failed : %s.", SysStrError (errno, &syserr)->data);
+            });
+            close (fd);
+            return NULL;
+        }
+
+        // pages are read once, front to back
+        madvise (view, window, MADV_SEQUENTIAL);
+        Sha256Update (&ctx, view, window);
+        munmap (view, window);
+    }
+
+    close (fd);
+#endif
+
+    return Sha256Final (&ctx, hex);
+}